@@ -34,38 +34,32 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  **************************************************************************************************/
 
 #include "core/ModelChecker.h"
+#include "utils/ParallelFor.h"
+
+#include <algorithm>
+#include <utility>
 
 namespace ctsat
 {
 bool ModelChecker::checkSat(vec<lbool> const & model, std::string const filename, vec<bool> const & wasDecision, bool const undefAsSat )
 {
-   gzFile f = gzopen(filename.c_str(), "rb");
-   if (f == NULL)
-      printf("c ERROR! Could not open file: %s\n", filename.c_str()), throw InputException();
+   DecompressReader f(filename);
    StreamBuffer in(f);
-   bool const res = checkSat(model, in,wasDecision,undefAsSat);
-   gzclose(f);
-   return res;
+   return checkSat(model, in,wasDecision,undefAsSat);
 }
 
 void ModelChecker::printSatisfiedClauses(vec<lbool> const & model, std::string const filename)
 {
-   gzFile f = gzopen(filename.c_str(), "rb");
-   if (f == NULL)
-      printf("c ERROR! Could not open file: %s\n", filename.c_str()), throw InputException();
+   DecompressReader f(filename);
    StreamBuffer in(f);
    printSatisfiedClauses(model, in);
-   gzclose(f);
 }
 
 void ModelChecker::printUndefClauses(vec<lbool> const & model, std::string const filename)
 {
-   gzFile f = gzopen(filename.c_str(), "rb");
-   if (f == NULL)
-      printf("c ERROR! Could not open file: %s\n", filename.c_str()), throw InputException();
+   DecompressReader f(filename);
    StreamBuffer in(f);
    printUndefClauses(model, in);
-   gzclose(f);
 }
 
 void ModelChecker::printClause(vec<lbool> const & model, vec<Lit> & c, vec<bool> const & wasDecision)
@@ -185,6 +179,63 @@ bool ModelChecker::printSatisfiedClauses(vec<lbool> const & model, StreamBuffer
    return ok;
 }
 
+bool ModelChecker::checkSat(vec<lbool> const & model, vec<Lit> const & clauses, vec<bool> const & wasDecision,
+                            int const nThreads, bool const undefAsSat)
+{
+   int const minChunkSize = 1 << 16;
+   int const nChunks = std::max(1, std::min(4 * nThreads, clauses.size() / minChunkSize));
+
+   // The chunks begin behind a clause end, so each clause belongs to exactly one chunk:
+   vec<int> begins(nChunks + 1, clauses.size());
+   begins[0] = 0;
+   for (int i = 1; i < nChunks; ++i)
+   {
+      int pos = std::max(begins[i - 1], static_cast<int>(static_cast<int64_t>(clauses.size()) * i / nChunks));
+      while (pos > 0 && pos < clauses.size() && clauses[pos - 1] != Lit::Undef())
+         ++pos;
+      begins[i] = pos;
+   }
+
+   vec<int> nClauses(nChunks, 0);
+   vec<vec<std::pair<int, int>>> failed(nChunks);  // begin and number of the unsatisfied clauses in the chunk
+   ParallelFor workers(nThreads);
+   workers.run(nChunks, [&](int const chunk, int)
+   {
+      bool isSat = false;
+      int begin = begins[chunk];
+      for (int i = begins[chunk]; i < begins[chunk + 1]; ++i)
+      {
+         if (clauses[i] == Lit::Undef())
+         {
+            if (!isSat)
+               failed[chunk].push(std::make_pair(begin, nClauses[chunk]));
+            ++nClauses[chunk];
+            isSat = false;
+            begin = i + 1;
+         } else if (!isSat)
+            isSat = isSatisfied(model, clauses[i], undefAsSat);
+      }
+   });
+
+   bool ok = true;
+   int cnt = 0;
+   vec<Lit> lits;
+   for (int chunk = 0; chunk < nChunks; ++chunk)
+   {
+      for (int i = 0; i < failed[chunk].size(); ++i)
+      {
+         printf("c clause %d is not satisfied\n", cnt + failed[chunk][i].second + 1);
+         lits.clear();
+         for (int j = failed[chunk][i].first; clauses[j] != Lit::Undef(); ++j)
+            lits.push(clauses[j]);
+         printClause(model, lits, wasDecision);
+         ok = false;
+      }
+      cnt += nClauses[chunk];
+   }
+   return ok;
+}
+
 bool ModelChecker::checkSat(vec<lbool> const & model, StreamBuffer & in, vec<bool> const & wasDecision, bool const undefAsSat )
 {
    vec<Lit> lits;
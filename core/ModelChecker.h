@@ -47,6 +47,10 @@ class ModelChecker
  public:
 
    static bool checkSat(vec<lbool> const & model, std::string const filename, vec<bool> const & wasDecision, bool const undefAsSat = false);
+   // Checks the model against clauses kept in memory, each terminated by Lit::Undef(). The clauses
+   // are split into chunks, which are checked by nThreads threads.
+   static bool checkSat(vec<lbool> const & model, vec<Lit> const & clauses, vec<bool> const & wasDecision,
+                        int const nThreads, bool const undefAsSat = false);
    static void printSatisfiedClauses(vec<lbool> const & model, std::string const filename);
    static void printUndefClauses(vec<lbool> const & model, std::string const filename);
 
@@ -56,6 +60,13 @@ class ModelChecker
    static bool checkSat(vec<lbool> const & model, StreamBuffer & in, vec<bool> const & wasDecision, bool const undefAsSat);
    static void printUndefClauses(vec<lbool> const & model, StreamBuffer & in);
 
+   static bool isSatisfied(vec<lbool> const & model, Lit const l, bool const undefAsSat)
+   {
+      lbool const val = model[l.var()];
+      assert(undefAsSat || !val.isUndef());
+      return (val.isUndef()) ? undefAsSat : val.isTrue() != l.sign();
+   }
+
    static void printClause(vec<lbool> const & model, vec<Lit> & c, vec<bool> const & wasDecision);
 
 };
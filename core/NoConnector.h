@@ -118,21 +118,64 @@ class NoConnector
    }
 
    template <typename ClauseType, typename ... Args>
-   inline bool exchange(uint64_t const & nBytes, Args ... args)
+   inline bool exchange(unsigned const producer, uint64_t const & nBytes, Args ... args)
    {
       return true;
    }
 
+   // Number of clauses a reader missed since the last call.
+   template <typename Pos>
+   uint64_t takeLostClauses(Pos const & pos)
+   {
+      return 0;
+   }
+
    unsigned getUniqueId()
    {
       return idCounter.fetch_add(1);
    }
 
+   // Increasing over all threads. Orders the exports and imports of the per thread proofs.
+   uint64_t getProofSyncPoint()
+   {
+      return proofSyncCounter.fetch_add(1) + 1;
+   }
+
    bool shouldImport(size_type const pos) const
    {
       return false;
    }
 
+   // Returns true, when a clause with this hash was exported recently and should not be exported
+   // again.
+   bool filterExport(uint32_t const hash)
+   {
+      return false;
+   }
+
+   // Tells the producer of imported clauses, how many of them were used in a conflict.
+   void reportImportUse(unsigned const producer, uint64_t const nUsed, uint64_t const nUnused)
+   {
+   }
+
+   // Returns the reports for the producer since the last call.
+   void takeExportUse(unsigned const producer, uint64_t & nUsed, uint64_t & nUnused)
+   {
+      nUsed = nUnused = 0;
+   }
+
+   // Part of the exchange buffer of the producer, which is not read by all readers yet.
+   double exportFillLevel(unsigned const producer) const
+   {
+      return 0;
+   }
+
+   // Returns false, when the exchange buffer of the producer can not grow.
+   bool growExportBuffer(unsigned const producer)
+   {
+      return false;
+   }
+
    void sleep()
    {
       usleep(uSleepTime);
@@ -148,6 +191,7 @@ class NoConnector
    std::atomic<int> result;
    std::atomic<int> numRunningThreads;
    std::atomic<int> numInitializedThreads;
+   std::atomic<uint64_t> proofSyncCounter;
    vec<lbool> model;
 
    struct Result
@@ -206,7 +250,8 @@ inline NoConnector::NoConnector()
         allowedToFreeMem(false),
         result(Result::Undef()),
         numRunningThreads(0),
-        numInitializedThreads(0)
+        numInitializedThreads(0),
+        proofSyncCounter(0)
 {
    if (abortConnectors.empty())
    {
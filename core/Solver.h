@@ -58,6 +58,11 @@
 #include "utils/DratPrint.h"
 #include "utils/Random.h"
 #include "minimize/Vivification.h"
+#include "minimize/Elimination.h"
+#include "minimize/Probing.h"
+#include "minimize/EquivalentLiterals.h"
+#include "minimize/Subsumption.h"
+#include "initial/EliminatedClauseDatabase.h"
 #include "analyze/FirstUipAnalyze.h"
 
 #include <vector>
@@ -103,7 +108,8 @@ class Solver
    Solver(
           SolverConfig const & config,
           typename TemplateConfig::Connector & connector,
-          SatInstance const & db);
+          SatInstance const & db,
+          DratPrint<Lit> && drat = DratPrint<Lit>());
    Solver(
           SolverConfig const & config,
           typename TemplateConfig::Connector & connector,
@@ -123,6 +129,14 @@ class Solver
 
    bool simplify();   // Removes already satisfied clauses.
    lbool solve();   // Search without assumptions.
+
+   // Cube-and-conquer: Searches under the literals of the cube for at most nConflicts conflicts.
+   // Returns false, when the cube is refuted (or the formula is unsatisfiable).
+   lbool solveCube(vec<Lit> const & cube, int64_t const nConflicts);
+   // Propagates the cube and picks the variable to split it on by a lookahead on the most frequent
+   // free variables. Returns false, when the cube is refuted. split is Lit::Undef(), when no
+   // variable is left.
+   bool splitCube(vec<Lit> const & cube, Lit & split);
    bool okay() const;   // FALSE means solver is in a conflicting state
 
    void setModel(vec<lbool> & model, vec<bool> const & isDecisionVar);
@@ -155,6 +169,11 @@ class Solver
    void checkGarbage();
 
    bool useVivification;
+   bool useInproElim;
+   bool useProbing;
+   bool useEquivalences;
+   bool useLearntSubsumption;
+   bool useGauss;
    int verbosity;
    double garbage_frac;  // The fraction of wasted memory allowed before a garbage collection is triggered.
 
@@ -176,14 +195,21 @@ class Solver
    typename TemplateConfig::PropEngine propEngine;
    typename TemplateConfig::Anaylze analyze;
    Vivification<typename TemplateConfig::PropEngine> vivification;
+   Elimination<typename TemplateConfig::PropEngine> elimination;
+   Probing<typename TemplateConfig::PropEngine> probing;
+   EquivalentLiterals<typename TemplateConfig::PropEngine> equivalences;
+   Subsumption<typename TemplateConfig::PropEngine> subsumption;
    typename TemplateConfig::Exchanger exchange;
 
+   EliminatedClauseDatabase elimDb;  // Clauses removed by inprocessing, extended before the preprocessor ones
+
    bool ok;  // If FALSE, the constraints are already unsatisfiable. No part of the solver state may be used!
    bool asynch_interrupt;
    bool remove_satisfied;  // Indicates whether possibly inefficient linear scan for satisfied clauses should be performed in 'simplify'.
    bool steady_simplify;
 
    vec<CRef> clauses;   // List of problem clauses.
+   vec<Lit> assumptions;   // Decided before any other literal, as long as their variables are decision variables.
 
  protected:
    Solver(SolverConfig const & config, typename TemplateConfig::Connector & connector);
@@ -239,6 +265,7 @@ class Solver
    // used, exept 'seen' wich is used in several places.
    //
    vec<Lit> add_tmp;
+   vec<Var> substituted;
 
    // Resource contraints:
    int64_t conflict_budget;   // -1 means no budget.
@@ -248,6 +275,15 @@ class Solver
    uint64_t curSimplify;
    uint64_t nbconfbeforesimplify;
    int incSimplify;
+   int inproElimInterval;
+   uint64_t viviLastPropagations;
+   uint64_t probeLastPropagations;
+   uint64_t subsumeLastPropagations;
+   vec<CRef> viviCandidates;
+   vec<int> cubeOccs;   // per variable
+   vec<Var> cubeCandidates;
+   bool cubeFailed;   // search() stopped at a false assumption
+   vec<CRef> subsumeCandidates;
 
    // returns minimum backtrack level
    int addLearntClauses();
@@ -266,6 +302,8 @@ class Solver
    CRef addLearnt(LearntClause<Database> const & lc, bool const additional = false);
 
    lbool search();   // Search for a given number of conflicts.
+   lbool solve_();   // Restarts search() until it finishes or the budget is exhausted.
+   lbool setResult(lbool status);   // Reports a result to the other threads.
    void removeSatisfied(vec<CRef>& cs);   // Shrink 'cs' to contain only non-satisfied clauses.
 
    ConflictData FindConflictLevel(CRef cind);
@@ -273,11 +311,20 @@ class Solver
    bool withinBudget() const;
 
    bool simplifyAll();
+   void vivifyLearnts();
    bool simplifyClause(CRef const & ref);
 
+   bool eliminate();   // Bounded variable elimination of touched variables at level 0.
+   bool probe();   // Failed literal probing of touched roots at level 0.
+   bool substituteEquivalences();   // Equivalent literal substitution at level 0.
+   bool substituteClause(CRef const cr);
+   bool subsumeLearnts();   // Forward subsumption of the learnts, except the local tier, at level 0.
+   bool addResolvent(vec<Lit> & ps, CRef & cr);
+
    bool removed(CRef cr);
 
    void attachClauses();
+   void initXors(vec<decltype(SatInstance::ca)::Lit> const & xors);
 
    bool repropagateCurrentSolution();
 
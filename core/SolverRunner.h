@@ -45,6 +45,7 @@
 #include "initial/Inputs.h"
 
 #include "initial/SatInstance.h"
+#include "initial/InstanceCache.h"
 #include "initial/SolverConfig.h"
 
 #include "initial/Preprocessor.h"
@@ -81,6 +82,7 @@
 #include "analyze/LevelAwareAnalyze.h"
 
 #include "core/Solver_impl.hpp"
+#include "parallel/CubeQueue.h"
 #include "utils/CPUBind.h"
 
 namespace ctsat
@@ -101,6 +103,8 @@ struct ThreadData
    SatInstance const & inst;
    Connector & conn;
    Statistic * stat;
+   std::string proofFile;  // the thread writes no proof, when empty
+   CubeQueue * cubes;  // the thread runs in the portfolio, when null
 
    ThreadData(ThreadData && in)
          : threadId(in.threadId),
@@ -108,7 +112,9 @@ struct ThreadData
            pthreadId(in.pthreadId),
            inst(in.inst),
            conn(in.conn),
-           stat(in.stat)
+           stat(in.stat),
+           proofFile(std::move(in.proofFile)),
+           cubes(in.cubes)
    {
 
    }
@@ -119,7 +125,8 @@ struct ThreadData
            pthreadId(),
            inst(inst),
            conn(conn),
-           stat(nullptr)
+           stat(nullptr),
+           cubes(nullptr)
    {
    }
 };
@@ -304,13 +311,48 @@ class SolverRunner
       }
    }
 
+   static void printModel(vec<lbool> & model, EliminatedClauseDatabase const & elimDb)
+   {
+      std::string const filename(Inputs::modelFile);
+      if (filename.empty())
+      {
+         elimDb.printModel(model, stdout, Inputs::modelBinary);
+         return;
+      }
+      FILE * out = fopen(filename.c_str(), "wb");
+      if (out == NULL)
+      {
+         fprintf(stderr, "c ERROR! Could not open the model file %s\n", filename.c_str());
+         return;
+      }
+      elimDb.printModel(model, out, Inputs::modelBinary);
+      fclose(out);
+   }
+
+   // Checks the model against the input clauses kept by the preprocessor. Falls back to reading
+   // the input file again, when they are not available (e.g. for a cached instance).
+   static bool checkModel(vec<lbool> const & model, SatInstance const & inst, int const nThreads,
+                          bool const undefAsSat = false)
+   {
+      if (inst.originalClauses.size() > 0)
+         return ModelChecker::checkSat(model, inst.originalClauses, inst.isDecisionVar, nThreads,
+                                       undefAsSat);
+      return ModelChecker::checkSat(model, (*Inputs::argv)[1], inst.isDecisionVar, undefAsSat);
+   }
+
    static SatInstance getInstance(std::string const & filename, SolverConfig const & config)
    {
-      LOG("Setting up preprocessor")
-      Preprocessor prepro(config);
-      LOG("Process instance " + filename)
-      SatInstance res = prepro.getInstance(filename);
-      if(res.isOk() && Inputs::verifySat && !ModelChecker::checkSat(res.model, (*Inputs::argv)[1], res.isDecisionVar, true))
+      SatInstance res;
+      InstanceCache cache(config);
+      if (!cache.load(filename, res))
+      {
+         LOG("Setting up preprocessor")
+         Preprocessor prepro(config);
+         LOG("Process instance " + filename)
+         res = prepro.getInstance(filename);
+         cache.store(res);
+      }
+      if(res.isOk() && Inputs::verifySat && !checkModel(res.model, res, config.preproThreads, true))
          std::cout << "c Warning: preprocessor already created unsolvable problem" << std::endl;
 //      ModelChecker::printSatisfiedClauses(res.model, filename);
       return res;
@@ -337,8 +379,7 @@ class SolverRunner
                   Analyze, NoClauseExchanger<Database, NoConnector, Propagate>>> solver(
             config, connector, std::move(inst));
 
-      if (solver.isOk())
-         ret = solver.solve();
+      ret = solver.solve();  // unsat, if the solver is not ok after initialization
       if (config.verbosity > 0)
       {
          solver.printFinalStats();
@@ -354,10 +395,10 @@ class SolverRunner
          elimDb.extendModel(model);
 
          if (Inputs::model)
-            elimDb.printModel(model);
+            printModel(model, elimDb);
          if (Inputs::verifySat)
          {
-            if (ModelChecker::checkSat(model, (*Inputs::argv)[1], inst.isDecisionVar))
+            if (checkModel(model, inst, config.preproThreads))
                std::cout << "c SAT solution is correct\n";
             else
                std::cout << "c Solution is WRONG!!!!\n";
@@ -369,15 +410,62 @@ class SolverRunner
    return ret;
 }
 
+// Takes cubes from the queue and solves them, until a thread finds a model or all cubes are refuted.
+// The cube of the thread is split, while other threads wait for one.
+template <typename SolverType, typename Connector>
+static lbool solveCubes(SolverType & solver, CubeQueue & cubes, Connector & conn)
+{
+   typedef typename SolverType::Lit Lit;
+   vec<Lit> cube;
+   lbool ret = lbool::Undef();
+   auto const isStopped = [&]()
+   {  return conn.isFinished();};
+   while (ret.isUndef() && cubes.take(cube, isStopped))
+   {
+      ++solver.stat.nCubes;
+      bool solved = false;
+      while (!solved && !conn.isFinished())
+      {
+         Lit split = Lit::Undef();
+         while (cubes.needsCubes() && cube.size() < Inputs::cubeMaxSize && !solved)
+         {
+            solved = !solver.splitCube(cube, split);
+            if (split == Lit::Undef())
+               break;
+            cube.push(~split);
+            cubes.add(cube);
+            cube.last() = split;
+            ++solver.stat.nCubeSplits;
+         }
+         if (solved)
+            ++solver.stat.nCubesRefuted;
+         else
+         {
+            ret = solver.solveCube(cube, Inputs::cubeConflicts);
+            solved = !ret.isUndef();
+         }
+      }
+      cubes.done();
+      if (ret.isFalse())
+         ret = lbool::Undef();  // only the cube is refuted
+   }
+   if (ret.isUndef() && cubes.isExhausted() && conn.setFinished(lbool::False()))
+   {
+      LOG("All cubes refuted")
+      ret = lbool::False();
+   }
+   return ret;
+}
+
 template <typename Connector, typename Database, typename Branch, typename Restart, typename Reduce,
       typename Propagate, typename Analyze, typename Exchanger>
 static lbool run_parallel(SolverConfig const & config, void * threadData)
 {
 LOG("Solving parallel")
-            assert(config.drat_file.size() == 0);
    lbool ret = lbool::Undef();
 
    ThreadData<Connector> & data = *reinterpret_cast<ThreadData<Connector>*>(threadData);
+   assert(config.drat_file.size() == 0 || data.proofFile.size() > 0);
    if (config.pinSolver && !NumaAwareSet::instance.isFallback)
    {
       LOG("Pinning solver")
@@ -388,12 +476,12 @@ LOG("Solving parallel")
    LOG("Initialize solver")
    Solver<
          TemplateConfiguration<Connector, Database, Branch, Restart, Reduce, Propagate, Analyze,
-               Exchanger>> solver(config, data.conn, data.inst);
+               Exchanger>> solver(config, data.conn, data.inst,
+                                  DratPrint<typename Database::Lit>(data.proofFile));
    data.stat = &solver.getStatistic();
    data.conn.notifyThreadInitialized();
 
-   if (solver.isOk())
-      ret = solver.solve();
+   ret = (data.cubes != nullptr) ? solveCubes(solver, *data.cubes, data.conn) : solver.solve();
 
    if (!ret.isUndef())
    {
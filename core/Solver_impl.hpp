@@ -58,6 +58,11 @@ Solver<TemplateConfig>::Solver(
                                SolverConfig const & config,
                                typename TemplateConfig::Connector & connector)
       : useVivification(config.useVivification),
+        useInproElim(config.useInproElim),
+        useProbing(config.useProbing),
+        useEquivalences(config.useEquivalences),
+        useLearntSubsumption(config.useLearntSubsumption),
+        useGauss(config.useGauss),
         verbosity(config.verbosity),
         garbage_frac(config.garbage_frac),
 
@@ -79,8 +84,13 @@ Solver<TemplateConfig>::Solver(
         reduce(config, stat, ca, ig),
         propEngine(stat, ca, ig),
         analyze(config, ca, ig, propEngine),
-        vivification(config, ca, ig, propEngine),
-        exchange(config, stat, ca, ig, connector, propEngine),
+        vivification(config, stat, ca, ig, propEngine),
+        elimination(config, stat, ca, ig),
+        probing(config, stat, ca, ig, propEngine),
+        equivalences(ig, propEngine),
+        subsumption(config, stat, ca, ig),
+        exchange(config, stat, ca, ig, connector, propEngine, drat),
+        elimDb(),
         ok(true),
         asynch_interrupt(false),
         remove_satisfied(config.remove_satisfied),
@@ -98,7 +108,12 @@ Solver<TemplateConfig>::Solver(
 
         curSimplify(1),
         nbconfbeforesimplify(config.nbconfbeforesimplify),
-        incSimplify(config.incSimplify)
+        incSimplify(config.incSimplify),
+        inproElimInterval(config.inproElimInterval),
+        viviLastPropagations(0),
+        probeLastPropagations(0),
+        subsumeLastPropagations(0),
+        cubeFailed(false)
 {
 }
 
@@ -106,9 +121,12 @@ template <typename TemplateConfig>
 Solver<TemplateConfig>::Solver(
                                SolverConfig const & config,
                                typename TemplateConfig::Connector & connector,
-                               SatInstance const & inst)
+                               SatInstance const & inst,
+                               DratPrint<Lit> && drat)
       : Solver(config, connector, inst.isDecisionVar, inst.ca, inst.clauses)
 {
+   this->drat = std::move(drat);
+   initXors(inst.xors);
 }
 
 template <typename TemplateConfig>
@@ -119,6 +137,7 @@ Solver<TemplateConfig>::Solver(
       : Solver(config, connector, inst.isDecisionVar, std::move(inst.ca), std::move(inst.clauses),
                std::move(inst.drat))
 {
+   initXors(inst.xors);
 }
 
 template <typename TemplateConfig>
@@ -128,6 +147,41 @@ void Solver<TemplateConfig>::attachClauses()
       propEngine.attachClause(clauses[i]);
 }
 
+// The xor variables are neither eliminated nor substituted, since they stay in the matrix.
+template <typename TemplateConfig>
+void Solver<TemplateConfig>::initXors(vec<decltype(SatInstance::ca)::Lit> const & xors)
+{
+   // reasons derived by Gauss-Jordan elimination are not in general derivable by unit propagation
+   if (!useGauss || xors.size() == 0 || drat.isActive())
+      return;
+   add_tmp.clear();
+   for (int i = 0; i < xors.size(); ++i)
+      if (xors[i] == Lit::Undef())
+      {
+         propEngine.gauss.addXor(add_tmp);
+         add_tmp.clear();
+      } else
+         add_tmp.push(xors[i]);
+
+   if (!propEngine.gauss.init(add_tmp))
+   {
+      setOk(false);
+      return;
+   }
+   for (int i = 0; i < add_tmp.size() && isOk(); ++i)
+      if (ig.value(add_tmp[i]).isUndef())
+         uncheckedEnqueue(add_tmp[i]);
+      else if (ig.value(add_tmp[i]).isFalse())
+         setOk(false);
+   add_tmp.clear();
+
+   for (Var v = 0; v < nVars(); ++v)
+      if (propEngine.gauss.isXorVar(v))
+         elimination.freeze(v);
+   if (verbosity > 0)
+      printf("c gauss: %d rows\n", propEngine.gauss.nRows());
+}
+
 template <typename TemplateConfig>
 Solver<TemplateConfig>::Solver(
                                SolverConfig const & config,
@@ -196,6 +250,7 @@ void Solver<TemplateConfig>::setModel(vec<lbool> & model, vec<bool> const & isDe
       assert(isDecisionVar[v]);
       model[v] = ig.value(v);
    }
+   elimDb.extendModel(model);
 }
 
 // return true, if the clause cr should be removed
@@ -203,7 +258,7 @@ template <typename TemplateConfig>
 bool Solver<TemplateConfig>::simplifyClause(CRef const & cr)
 {
    Clause & c = ca[cr];
-   if (removed(cr) || ig.satisfied(c))
+   if (removed(cr) || vivification.rootSatisfied(c))
    {
       ca.remove(cr);
       return true;
@@ -214,12 +269,13 @@ bool Solver<TemplateConfig>::simplifyClause(CRef const & cr)
 //      if (!propEngine.isAttached(cr))  //TODO
 //         std::cout << "is bad attached: " << propEngine.isBadAttached(cr) << "\n";
       propEngine.detachClause(cr, true);
-      if (vivification.run(c))
+      if (vivification.run(c, cr))
          drat.addClause(c);
 
       assert(c.size() > 0);
       if (c.size() == 1)
       {
+         vivification.resetTrail();
          exchange.unitLearnt(c[0]);
          uncheckedEnqueue(c[0]);
          if (propagate() != CRef_Undef)
@@ -245,7 +301,8 @@ inline bool Solver<TemplateConfig>::simplifyAll()
    assert(isOk());
    // simplify
    //
-   if (useVivification && stat.conflicts >= curSimplify * nbconfbeforesimplify)
+   if ((useVivification || useInproElim || useProbing || useEquivalences || useLearntSubsumption)
+      && stat.conflicts >= curSimplify * nbconfbeforesimplify)
    {
       LOG("Simplifies clauses");
       if (propagate() != CRef_Undef)
@@ -254,18 +311,16 @@ inline bool Solver<TemplateConfig>::simplifyAll()
       {
          ++nbSimplifyAll;
 
-         reduce.applyRemoveGoodClauses([&](CRef const & cr)
-         {
-            if (withinBudget() && isOk())
-            {
-               // ensure polling import clauses also when load on simplification is high
-               if (exchange.shouldFetch())
-               exchange.fetchClauses();
-               return simplifyClause(cr);
-            }
-            else
-            return false;
-         });
+         if (useEquivalences && withinBudget())
+            substituteEquivalences();
+         if (useProbing && isOk() && withinBudget())
+            probe();
+         if (useLearntSubsumption && isOk() && withinBudget())
+            subsumeLearnts();
+         if (useVivification && isOk())
+            vivifyLearnts();
+         if (useInproElim && isOk() && nbSimplifyAll % inproElimInterval == 0 && withinBudget())
+            eliminate();
          checkGarbage();
          if (steady_simplify)
          {
@@ -284,6 +339,346 @@ inline bool Solver<TemplateConfig>::simplifyAll()
    return isOk();
 }
 
+// vivifies the learnts tier by tier, where the last tier is limited by the local effort
+template <typename TemplateConfig>
+void Solver<TemplateConfig>::vivifyLearnts()
+{
+   typedef typename TemplateConfig::Reduce Reduce;
+   uint64_t const searchProps = stat.propagations - viviLastPropagations;
+   for (int tier = 0; tier < Reduce::nTiers && isOk(); ++tier)
+   {
+      viviCandidates.clear();
+      reduce.applyTierClauses(tier, [&](CRef const & cr)
+      {
+         if (!removed(cr) && !ca[cr].simplified())
+            viviCandidates.push(cr);
+      });
+      vivification.schedule(viviCandidates);
+
+      bool const isLimited = tier > 0 && tier == Reduce::nTiers - 1;
+      uint64_t const propLimit = stat.s_propagations
+         + static_cast<uint64_t>(vivification.localEffort * searchProps);
+      for (int i = 0; i < viviCandidates.size() && isOk() && withinBudget(); ++i)
+      {
+         if (isLimited && stat.s_propagations > propLimit)
+            break;
+         // ensure polling import clauses also when load on simplification is high
+         if (exchange.shouldFetch())
+         {
+            vivification.resetTrail();
+            exchange.fetchClauses();
+         }
+         simplifyClause(viviCandidates[i]);
+      }
+      vivification.resetTrail();
+   }
+   reduce.applyRemoveAllClauses([&](CRef const & cr)
+   {
+      return removed(cr);
+   });
+   viviLastPropagations = stat.propagations;
+}
+
+template <typename TemplateConfig>
+bool Solver<TemplateConfig>::addResolvent(vec<Lit> & ps, CRef & cr)
+{
+   cr = Database::npos();
+   if (ig.removeRedundant(ps))
+      return true;
+   drat.addClause(ps);
+
+   if (ps.size() == 0)
+      return setOk(false);
+   else if (ps.size() == 1)
+   {
+      exchange.unitLearnt(ps[0]);
+      uncheckedEnqueue(ps[0]);
+      return setOk(propagate() == CRef_Undef);
+   }
+   cr = ca.alloc(ps, false);
+   clauses.push(cr);
+   propEngine.attachClause(cr);
+   return true;
+}
+
+template <typename TemplateConfig>
+bool Solver<TemplateConfig>::eliminate()
+{
+   assert(ig.decisionLevel() == 0);
+   if (!elimination.hasTouched())
+      return true;
+   LOG("Eliminates variables")
+
+   // Collect occurrences. Satisfied original clauses are removed and false literals are
+   // removed from the remaining, so the resolvents stay short:
+   elimination.clearOccurrences();
+   int i, j;
+   for (i = j = 0; i < clauses.size(); ++i)
+   {
+      CRef cr = clauses[i];
+      if (removed(cr))
+         continue;
+      Clause const & c = ca[cr];
+      if (ig.satisfied(c))
+      {
+         removeClause(cr);
+         continue;
+      }
+      add_tmp.clear();
+      for (int k = 0; k < c.size(); ++k)
+         if (!ig.value(c[k]).isFalse())
+            add_tmp.push(c[k]);
+      if (add_tmp.size() < c.size())
+      {
+         assert(add_tmp.size() > 1);
+         drat.addClause(add_tmp);
+         removeClause(cr);
+         cr = ca.alloc(add_tmp, false);
+         propEngine.attachClause(cr);
+      }
+      elimination.addOccurrences(cr);
+      clauses[j++] = cr;
+   }
+   clauses.shrink(i - j);
+   reduce.applyRemoveAllClauses([&](CRef const & cr)
+   {
+      if (removed(cr))
+      return true;
+      elimination.addOccurrences(cr);
+      return false;
+   });
+
+   bool const res = elimination.run(elimDb, branch, [&](vec<Lit> & ps, CRef & cr)
+   {  return addResolvent(ps, cr);},
+                                    [&](CRef const cr)
+                                    {  removeClause(cr);});
+
+   // drop the references of removed clauses:
+   for (i = j = 0; i < clauses.size(); ++i)
+      if (!removed(clauses[i]))
+         clauses[j++] = clauses[i];
+   clauses.shrink(i - j);
+   reduce.applyRemoveAllClauses([&](CRef const & cr)
+   {  return removed(cr);});
+
+   LOG("Elimination finished")
+   return res && isOk();
+}
+
+template <typename TemplateConfig>
+bool Solver<TemplateConfig>::probe()
+{
+   assert(ig.decisionLevel() == 0);
+   if (!probing.hasTouched())
+      return true;
+   LOG("Probes literals")
+
+   uint64_t const searchProps = stat.propagations - probeLastPropagations;
+   probeLastPropagations = stat.propagations;
+   bool const res = probing.run(branch, searchProps, [&](Lit const l)
+   {
+      add_tmp.clear();
+      add_tmp.push(l);
+      drat.addClause(add_tmp);
+      exchange.unitLearnt(l);
+      uncheckedEnqueue(l);
+      return setOk(propagate() == CRef_Undef);
+   },
+                                [&](Lit const l1, Lit const l2)
+                                {
+                                   add_tmp.clear();
+                                   add_tmp.push(l1);
+                                   add_tmp.push(l2);
+                                   drat.addClause(add_tmp);
+                                   CRef const cr = ca.alloc(add_tmp, true);
+                                   ca[cr].set_lbd(2);
+                                   propEngine.attachClause(cr);
+                                   reduce.addClause(cr);
+                                   exchange.clauseLearnt(cr);
+                                });
+
+   LOG("Probing finished")
+   return res && isOk();
+}
+
+template <typename TemplateConfig>
+bool Solver<TemplateConfig>::substituteEquivalences()
+{
+   assert(ig.decisionLevel() == 0);
+   if (!equivalences.run([&](Var const v)
+   {  return branch.isDecisionVar(v) && !propEngine.gauss.isXorVar(v);}))
+   {
+      add_tmp.clear();
+      add_tmp.push(~equivalences.contradiction());
+      drat.addClause(add_tmp);
+      return setOk(false);
+   }
+   if (equivalences.nSubstituted() == 0)
+      return true;
+   LOG("Substitutes equivalent literals")
+   ++stat.nSubstRounds;
+
+   // the equivalences make every substituted clause derivable by unit propagation
+   substituted.clear();
+   for (Var v = 0; v < nVars(); ++v)
+   {
+      Lit const r = equivalences.representative(Lit(v, false));
+      if (r.var() == v)
+         continue;
+      substituted.push(v);
+      add_tmp.clear();
+      add_tmp.push(Lit(v, true));
+      add_tmp.push(r);
+      drat.addClause(add_tmp);
+      add_tmp[0] = Lit(v, false);
+      add_tmp[1] = ~r;
+      drat.addClause(add_tmp);
+
+      branch.setDecisionVar(v, false);
+      elimDb.addElimEquivalence(v, r);
+   }
+   stat.nSubstVars += substituted.size();
+
+   int i, j;
+   for (i = j = 0; i < clauses.size(); ++i)
+   {
+      CRef const cr = clauses[i];
+      if (!removed(cr) && (!isOk() || !substituteClause(cr)))
+         clauses[j++] = cr;
+   }
+   clauses.shrink(i - j);
+   reduce.applyRemoveAllClauses([&](CRef const & cr)
+   {  return removed(cr) || (isOk() && substituteClause(cr));});
+   if (isOk() && propagate() != CRef_Undef)
+      setOk(false);
+
+   for (i = 0; i < substituted.size(); ++i)
+   {
+      Var const v = substituted[i];
+      Lit const r = equivalences.representative(Lit(v, false));
+      add_tmp.clear();
+      add_tmp.push(Lit(v, true));
+      add_tmp.push(r);
+      drat.removeClause(add_tmp);
+      add_tmp[0] = Lit(v, false);
+      add_tmp[1] = ~r;
+      drat.removeClause(add_tmp);
+   }
+
+   LOG("Substitution finished")
+   return isOk();
+}
+
+// Replaces the literals of cr by their representatives. Returns true, if cr was removed.
+template <typename TemplateConfig>
+bool Solver<TemplateConfig>::substituteClause(CRef const cr)
+{
+   Clause & c = ca[cr];
+   int k = 0;
+   while (k < c.size() && equivalences.representative(c[k]) == c[k])
+      ++k;
+   if (k == c.size())
+      return false;
+
+   add_tmp.clear();
+   for (k = 0; k < c.size(); ++k)
+      add_tmp.push(equivalences.representative(c[k]));
+   if (ig.removeRedundant(add_tmp))
+   {
+      removeClause(cr);
+      return true;
+   }
+   drat.addClause(add_tmp);
+   if (add_tmp.size() < 2)
+   {
+      removeClause(cr);
+      if (add_tmp.size() == 0)
+      {
+         setOk(false);
+         return true;
+      }
+      // propagated after the substitution, so no clause with old literals becomes a reason
+      exchange.unitLearnt(add_tmp[0]);
+      uncheckedEnqueue(add_tmp[0]);
+      return true;
+   }
+
+   propEngine.detachClause(cr, true);
+   drat.removeClause(c);
+   bool const isOriginal = c.getLearnt() == 0;
+   if (isOriginal)
+      elimination.touch(c);
+   for (k = 0; k < add_tmp.size(); ++k)
+      c[k] = add_tmp[k];
+   c.shrink(c.size() - add_tmp.size());
+   if (isOriginal)
+   {
+      if (c.has_extra())
+         c.calcAbstraction();
+      elimination.touch(c);
+   }
+   propEngine.attachClause(cr);
+   return false;
+}
+
+template <typename TemplateConfig>
+bool Solver<TemplateConfig>::subsumeLearnts()
+{
+   typedef typename TemplateConfig::Reduce Reduce;
+   assert(ig.decisionLevel() == 0);
+   LOG("Subsumes learnts")
+
+   uint64_t const searchProps = stat.propagations - subsumeLastPropagations;
+   subsumeLastPropagations = stat.propagations;
+   subsumeCandidates.clear();
+   for (int tier = 0; tier < Reduce::nTiers - 1; ++tier)
+      reduce.applyTierClauses(tier, [&](CRef const & cr)
+      {
+         if (!removed(cr))
+         subsumeCandidates.push(cr);
+      });
+
+   bool const res = subsumption.run(subsumeCandidates, searchProps, [&](CRef const cr, CRef const by)
+   {
+      // the subsuming clause inherits the better lbd, so it moves to the tier of cr
+      Clause & d = ca[by];
+      if (ca[cr].lbd() < d.lbd())
+      {
+         d.set_lbd(ca[cr].lbd());
+         reduce.clauseImproved(by);
+      }
+      removeClause(cr);
+   },
+                                    [&](CRef const cr, Lit const l)
+                                    {
+                                       Clause & c = ca[cr];
+                                       drat.addClauseExcludeLit(c, l);
+                                       if (c.size() == 2)
+                                       {
+                                          Lit const unit = (c[0] == l) ? c[1] : c[0];
+                                          removeClause(cr);
+                                          exchange.unitLearnt(unit);
+                                          uncheckedEnqueue(unit);
+                                          return setOk(propagate() == CRef_Undef);
+                                       }
+                                       propEngine.detachClause(cr, true);
+                                       drat.removeClause(c);
+                                       remove(c, l);
+                                       propEngine.attachClause(cr);
+                                       if (c.lbd() > c.size())
+                                       {
+                                          c.set_lbd(c.size());
+                                          reduce.clauseImproved(cr);
+                                       }
+                                       return true;
+                                    });
+
+   reduce.applyRemoveAllClauses([&](CRef const & cr)
+   {  return removed(cr);});
+   LOG("Subsumption finished")
+   return res && isOk();
+}
+
 //=================================================================================================
 // Minor methods:
 
@@ -298,6 +693,9 @@ inline typename Solver<TemplateConfig>::Var Solver<TemplateConfig>::newVar(bool
    ig.newVar();
    branch.setDecisionVar(v, dvar);
    propEngine.newVar();
+   elimination.newVar();
+   probing.newVar();
+   subsumption.newVar();
    return v;
 }
 
@@ -312,7 +710,11 @@ void Solver<TemplateConfig>::removeClause(CRef const cr)
 {
    Clause& c = ca[cr];
    if (c.mark() != 1)
+   {
       drat.removeClause(c);  // FIXME drat must be in database
+      if (c.getLearnt() == 0)
+         elimination.touch(c);
+   }
 
    propEngine.detachClause(cr);
 // Don't leave pointers to free'd memory!
@@ -639,6 +1041,7 @@ typename Solver<TemplateConfig>::CRef Solver<TemplateConfig>::addLearnt(
 {
    CRef cr = Database::npos();
    drat.addClause(lc.c);
+   probing.touch(lc.c);
    if (lc.c.size() == 1)
       exchange.unitLearnt(lc.c[0]);
    else
@@ -706,7 +1109,21 @@ typename Solver<TemplateConfig>::lbool Solver<TemplateConfig>::search()
             checkGarbage();
       }
 
-      Lit const next = branch.pickBranchLit();
+      Lit next = Lit::Undef();
+      for (int i = 0; i < assumptions.size() && next == Lit::Undef(); ++i)
+      {
+         Lit const p = assumptions[i];
+         if (!branch.isDecisionVar(p.var()) || ig.value(p).isTrue())
+            continue;
+         if (ig.value(p).isFalse())
+         {
+            cubeFailed = true;
+            return lbool::False();
+         }
+         next = p;
+      }
+      if (next == Lit::Undef())
+         next = branch.pickBranchLit();
       if (next == Lit::Undef())
       {
          // Model found:
@@ -720,16 +1137,50 @@ typename Solver<TemplateConfig>::lbool Solver<TemplateConfig>::search()
    }
 }
 
-// NOTE: assumptions passed in member-variable 'assumptions'.
 template <typename TemplateConfig>
 typename Solver<TemplateConfig>::lbool Solver<TemplateConfig>::solve()
 {
    LOG("Starts solving")
-   if (!isOk())
-      return lbool::False();
-   lbool status = lbool::Undef();
-
    add_tmp.clear();
+   assumptions.clear();
+
+   lbool status = solve_();
+
+   if (verbosity >= 1)
+      printf("c ===============================================================================\n");
+
+   status = setResult(status);
+   LOG("Ends solving")
+   return status;
+}
+
+template <typename TemplateConfig>
+typename Solver<TemplateConfig>::lbool Solver<TemplateConfig>::solveCube(vec<Lit> const & cube,
+                                                                         int64_t const nConflicts)
+{
+   int64_t const budget = conflict_budget;
+   cube.copyTo(assumptions);
+   cubeFailed = false;
+   setConfBudget(nConflicts);
+
+   lbool status = solve_();
+
+   conflict_budget = budget;
+   assumptions.clear();
+   if (status.isFalse() && cubeFailed)
+   {
+      cancelUntil(0);
+      ++stat.nCubesRefuted;
+      return status;
+   }
+   return setResult(status);
+}
+
+// Assumptions passed in member-variable 'assumptions'.
+template <typename TemplateConfig>
+typename Solver<TemplateConfig>::lbool Solver<TemplateConfig>::solve_()
+{
+   lbool status = lbool::Undef();
 
 // Search:
    while (status == lbool::Undef() && withinBudget() && !exchange.isFinished())
@@ -749,10 +1200,12 @@ LOG("Start")
          status = search();
       }
    }
+   return status;
+}
 
-   if (verbosity >= 1)
-      printf("c ===============================================================================\n");
-
+template <typename TemplateConfig>
+typename Solver<TemplateConfig>::lbool Solver<TemplateConfig>::setResult(lbool status)
+{
    if (status != lbool::Undef() && exchange.setFinished(status))
    {
       LOG("Solver won")
@@ -769,10 +1222,81 @@ LOG("Start")
       }
    } else
       status = lbool::Undef();
-   LOG("Ends solving")
    return status;
 }
 
+template <typename TemplateConfig>
+bool Solver<TemplateConfig>::splitCube(vec<Lit> const & cube, Lit & split)
+{
+   static int const nLookaheadVars = 32;
+   assert(ig.decisionLevel() == 0);
+   split = Lit::Undef();
+   for (int i = 0; i < cube.size(); ++i)
+   {
+      Lit const p = cube[i];
+      if (!branch.isDecisionVar(p.var()) || ig.value(p).isTrue())
+         continue;
+      if (ig.value(p).isFalse())
+      {
+         cancelUntil(0);
+         return false;
+      }
+      ig.newDecisionLevel();
+      uncheckedEnqueue(p, ig.decisionLevel());
+      if (propagate() != Database::npos())
+      {
+         cancelUntil(0);
+         return false;
+      }
+   }
+
+   // the free variables occurring most often in the not satisfied clauses are candidates:
+   cubeOccs.clear();
+   cubeOccs.growTo(nVars(), 0);
+   for (int i = 0; i < clauses.size(); ++i)
+   {
+      if (removed(clauses[i]))
+         continue;
+      Clause const & c = ca[clauses[i]];
+      if (ig.satisfied(c))
+         continue;
+      for (int j = 0; j < c.size(); ++j)
+         ++cubeOccs[c[j].var()];
+   }
+   cubeCandidates.clear();
+   for (Var v = 0; v < nVars(); ++v)
+      if (cubeOccs[v] > 0 && ig.value(v).isUndef() && branch.isDecisionVar(v))
+         cubeCandidates.push(v);
+   sort(cubeCandidates, [&](Var const a, Var const b)
+   {  return cubeOccs[a] > cubeOccs[b];});
+
+   // the number of propagated literals of both phases decides like in march:
+   int const level = ig.decisionLevel();
+   uint64_t bestScore = 0;
+   for (int i = 0; i < cubeCandidates.size() && i < nLookaheadVars; ++i)
+   {
+      uint64_t nProps[2];
+      for (int sign = 0; sign < 2; ++sign)
+      {
+         Lit const l(cubeCandidates[i], sign);
+         int const nAssigned = ig.nAssigns();
+         ig.newDecisionLevel();
+         uncheckedEnqueue(l, ig.decisionLevel());
+         bool const failed = propagate() != Database::npos();
+         nProps[sign] = failed ? nVars() : ig.nAssigns() - nAssigned;
+         cancelUntil(level);
+      }
+      uint64_t const score = nProps[0] * nProps[1] + nProps[0] + nProps[1];
+      if (score > bestScore)
+      {
+         bestScore = score;
+         split = Lit(cubeCandidates[i], false);
+      }
+   }
+   cancelUntil(0);
+   return true;
+}
+
 template <typename TemplateConfig>
 void Solver<TemplateConfig>::printFinalStats() const
 {
@@ -60,12 +60,37 @@ class Statistic
            nPromoted(0),
            nReceivedClauses(0),
            nSendClauses(0),
+           nSendBytes(0),
            nLostClauses(0),
+           nExportBufferGrown(0),
+           nExportLimitTightened(0),
+           nExportLimitTightenedByUse(0),
+           nFilteredExports(0),
+           nFilteredImports(0),
            nHoldBackImported(0),
+           nCubes(0),
+           nCubesRefuted(0),
+           nCubeSplits(0),
            chrono_backtrack(0),
            non_chrono_backtrack(0),
            level_backtracked(0),
            s_propagations(0),
+           nViviClauses(0),
+           nViviStrengthened(0),
+           nViviDecisions(0),
+           nViviReusedDecisions(0),
+           nInproElimRounds(0),
+           nInproElimVars(0),
+           nProbeRounds(0),
+           nProbeUnits(0),
+           nProbeBinaries(0),
+           nSubstRounds(0),
+           nSubstVars(0),
+           nSubsumeRounds(0),
+           nSubsumedLearnts(0),
+           nStrengthenedLearnts(0),
+           nGaussProps(0),
+           nGaussConflicts(0),
            simpDB_props(0),
            simpDB_assigns(0),
            global_lbd_sum(0)
@@ -89,14 +114,41 @@ class Statistic
    uint64_t nPromoted;
    uint64_t nReceivedClauses;
    uint64_t nSendClauses;
+   uint64_t nSendBytes;
    uint64_t nLostClauses;
+   uint64_t nExportBufferGrown;     // flow control of the clause export
+   uint64_t nExportLimitTightened;
+   uint64_t nExportLimitTightenedByUse;
+   uint64_t nFilteredExports;  // clauses exported by another thread before
+   uint64_t nFilteredImports;  // imported clauses, which this thread learnt itself
    uint64_t nHoldBackImported;
 
+   uint64_t nCubes;  // cube-and-conquer: cubes taken, refuted and split for idle threads
+   uint64_t nCubesRefuted;
+   uint64_t nCubeSplits;
+
    uint64_t chrono_backtrack;
    uint64_t non_chrono_backtrack;
    uint64_t level_backtracked;
 
    uint64_t s_propagations;
+   uint64_t nViviClauses;
+   uint64_t nViviStrengthened;
+   uint64_t nViviDecisions;
+   uint64_t nViviReusedDecisions;  // decisions kept on the trail from the previous vivified clause
+
+   uint64_t nInproElimRounds;
+   uint64_t nInproElimVars;
+   uint64_t nProbeRounds;
+   uint64_t nProbeUnits;
+   uint64_t nProbeBinaries;
+   uint64_t nSubstRounds;
+   uint64_t nSubstVars;
+   uint64_t nSubsumeRounds;
+   uint64_t nSubsumedLearnts;
+   uint64_t nStrengthenedLearnts;
+   uint64_t nGaussProps;
+   uint64_t nGaussConflicts;
 
    int64_t simpDB_props;  // Remaining number of propagations that must be made before next execution of 'simplify()'.
    int simpDB_assigns;  // Number of top-level assignments since last execution of 'simplify()'.
@@ -113,6 +165,9 @@ class Statistic
             static_cast<double>(s_propagations * 100)
                / (s_propagations + std::max(propagations, 1ul)),
             memUsedPeak());
+      printf("c vivi:%-12" PRIu64 " strengthened:%-12" PRIu64 " reused dec:%2.2f%%\n",
+             nViviClauses, nViviStrengthened,
+             static_cast<double>(nViviReusedDecisions * 100) / std::max(nViviDecisions, 1ul));
       printf("c ######################################################################\n");
    }
 
@@ -131,11 +186,24 @@ class Statistic
              (non_chrono_backtrack * 100) / (double) (non_chrono_backtrack + chrono_backtrack),
              (chrono_backtrack * 100) / (double) (non_chrono_backtrack + chrono_backtrack));
       printf("c additional learnt     : %-12" PRIu64"\n", nAdditionalLearnt);
+      printf("c inprocess elim vars   : %-12" PRIu64"   (%" PRIu64" rounds)\n", nInproElimVars,
+             nInproElimRounds);
+      printf("c probing units         : %-12" PRIu64"   (%" PRIu64" binaries, %" PRIu64" rounds)\n",
+             nProbeUnits, nProbeBinaries, nProbeRounds);
+      printf("c substituted vars      : %-12" PRIu64"   (%" PRIu64" rounds)\n", nSubstVars,
+             nSubstRounds);
+      printf("c subsumed learnts      : %-12" PRIu64"   (%" PRIu64" strengthened, %" PRIu64" rounds)\n",
+             nSubsumedLearnts, nStrengthenedLearnts, nSubsumeRounds);
+      printf("c gauss propagations    : %-12" PRIu64"   (%" PRIu64" conflicts)\n", nGaussProps,
+             nGaussConflicts);
 
       double const mem_used = memUsedPeak();
       if (mem_used != 0)
          printf("c Memory used           : %.2f MB\n", mem_used);
       printf("c CPU time              : %g s\n", cpu_time);
+      if (nExportBufferGrown > 0 || nExportLimitTightened > 0)
+         printf("c export buffer grown   : %-12" PRIu64"   (limits tightened %" PRIu64" times)\n",
+                nExportBufferGrown, nExportLimitTightened);
       if (nLostClauses > 0)
          std::cout
             << "c Warning: Lost "
@@ -0,0 +1,33 @@
+/root/repo/core/Main.o /root/repo/core/Main.or /root/repo/core/Main.od /root/repo/core/Main.op: /root/repo/core/Main.cc ../core/SolverRunner.h ../utils/System.h \
+ ../utils/ParseUtils.h ../utils/DecompressReader.h \
+ ../utils/ResourceLimits.h ../utils/Options.h ../mtl/Vec.h \
+ ../mtl/XAlloc.h ../utils/Exceptions.h ../initial/Inputs.h \
+ ../initial/SatInstance.h ../utils/DratPrint.h ../utils/ProofWriter.h \
+ ../initial/EliminatedClauseDatabase.h ../database/MinisatAllocatorDb.h \
+ ../database/BasicTypes.h ../mtl/Alloc.h ../mtl/Alg.h \
+ ../initial/InstanceCache.h ../initial/SolverConfig.h ../utils/CPUBind.h \
+ ../initial/Preprocessor.h ../mtl/Queue.h ../mtl/Heap.h ../mtl/OccLists.h \
+ ../core/ImplicationGraph.h ../mtl/Sort.h ../core/Statistic.h \
+ ../branch/Branch.h ../utils/Random.h ../core/SolveMode.h \
+ ../propagate/MiniSatPropagate.h ../propagate/GaussJordan.h \
+ ../minimize/EquivalentLiterals.h ../utils/ParallelFor.h \
+ ../utils/MappedFile.h ../initial/EliminatedClauseDatabase.h \
+ ../core/ModelChecker.h ../core/Solver.h ../mtl/AvgQueue.h \
+ ../minimize/Vivification.h ../minimize/Elimination.h \
+ ../minimize/Probing.h ../minimize/Subsumption.h \
+ ../analyze/FirstUipAnalyze.h ../minimize/BasicInprocess.h \
+ ../branch/DistLrbVsidsBranch.h ../utils/Timer.h ../branch/Dist.h \
+ ../branch/Vsids.h ../branch/Lrb.h ../reduce/ChanseokOh.h \
+ ../reduce/Glucose.h ../restart/GlucoseLuby.h ../restart/Glucose.h \
+ ../restart/Luby.h ../core/NoConnector.h ../exchange/NoClauseExchanger.h \
+ ../exchange/SimpleClauseExchanger.h ../exchange/ExportClause.h \
+ ../exchange/ConflictExchange.h ../analyze/MultiUipAnalyze.h \
+ ../analyze/LevelAwareAnalyze.h ../analyze/ConflictCore.h \
+ ../core/Solver_impl.hpp ../utils/Logger.h ../parallel/CubeQueue.h
+/root/repo/core/ModelChecker.o /root/repo/core/ModelChecker.or /root/repo/core/ModelChecker.od /root/repo/core/ModelChecker.op: /root/repo/core/ModelChecker.cc ../core/ModelChecker.h \
+ ../database/BasicTypes.h ../mtl/Vec.h ../mtl/XAlloc.h \
+ ../utils/Exceptions.h ../utils/ParseUtils.h ../utils/DecompressReader.h \
+ ../utils/ParallelFor.h
+/root/repo/core/NoConnector.o /root/repo/core/NoConnector.or /root/repo/core/NoConnector.od /root/repo/core/NoConnector.op: /root/repo/core/NoConnector.cc ../core/NoConnector.h \
+ ../mtl/Vec.h ../mtl/XAlloc.h ../utils/Exceptions.h \
+ ../database/BasicTypes.h
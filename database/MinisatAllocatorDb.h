@@ -127,9 +127,11 @@ class Clause
       }
    }
 
-   Clause(Clause const & c)
+   // NOTE: Only learnts keep their extra fields, if use_extra is false.
+   Clause(Clause const & c, bool use_extra)
          : header(c.header)
    {
+      header.has_extra = use_extra || header.learnt;
       for (int i = 0; i < c.size(); i++)
          data[i].lit = c[i];
 
@@ -227,7 +229,11 @@ inline void Clause::shrink(int i)
 {
    assert(i <= size());
    if (header.has_extra)
+   {
       data[header.size - i] = data[header.size];
+      if (header.learnt)
+         data[header.size - i + 1] = data[header.size + 1];
+   }
    header.size -= i;
 }
 inline void Clause::pop()
@@ -437,7 +443,7 @@ class ClauseAllocator : public RegionAllocator<uint32_t>
    {
       int extras = (c.getLearnt() > 0) ? 2 : (int) extra_clause_field;
       CRef cid = RegionAllocator<uint32_t>::alloc(clauseWord32Size(c.size(), extras));
-      new (lea(cid)) Clause(c);
+      new (lea(cid)) Clause(c, extra_clause_field);
       return cid;
    }
 
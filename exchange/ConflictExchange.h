@@ -72,7 +72,8 @@ class ConflictExchange : public SimpleClauseExchanger<Database, Connector, PropE
                     Database & db,
                     ImplicationGraph<Database> & ig,
                     Connector & conn,
-                    PropEngine & propEngine);
+                    PropEngine & propEngine,
+                    DratPrint<Lit> & drat);
    ~ConflictExchange();
 
    void clauseUsedInConflict(CRef const ref);
@@ -95,6 +96,7 @@ class ConflictExchange : public SimpleClauseExchanger<Database, Connector, PropE
    uint64_t lastFetch;
    PropEngine & propEngine;
    vec<CRef> nonConflClauses;
+   vec<unsigned> nonConflProducers;  // the id of the exporter of each clause in nonConflClauses
    vec<CRef> conflClauses;
 
    void exportClause(Clause & c);
@@ -115,8 +117,9 @@ inline ConflictExchange<Database, Connector, PropEngine>::ConflictExchange(
                                                                            Database& db,
                                                                            ImplicationGraph<Database>& ig,
                                                                            Connector& conn,
-                                                                           PropEngine& propEngine)
-      : Super(config, stat, db, ig, conn, propEngine),
+                                                                           PropEngine& propEngine,
+                                                                           DratPrint<Lit> & drat)
+      : Super(config, stat, db, ig, conn, propEngine, drat),
         allowNonChronoTrail(config.chrono > -1),
         onlyExportWhenMin(config.onlyExportWhenMin),
         minAttachLevel(Super::ig.nVars()),
@@ -209,6 +212,7 @@ inline void ConflictExchange<Database, Connector, PropEngine>::fetchClauses()
    Super::fetchClauses();
    int i = 0, j = 0, level;
    vec<CRef> & clauses = Super::clauses;
+   vec<unsigned> & producers = Super::clauseProducers;
    minAttachLevel = Super::ig.nVars();
    for (; i < clauses.size(); ++i)
    {
@@ -219,17 +223,20 @@ inline void ConflictExchange<Database, Connector, PropEngine>::fetchClauses()
          Clause & c = Super::db[ref];
          c.setExport(2);
          nonConflClauses.push(ref);
+         nonConflProducers.push(producers[i]);
          ++Super::stat.nHoldBackImported;
 
          c.setLearnt(2);
          propEngine.safeAttachClause(ref);
       } else
       {
+         producers[j] = producers[i];
          clauses[j++] = clauses[i];
          minAttachLevel = (level < minAttachLevel) ? level : minAttachLevel;
       }
    }
    clauses.shrink(i - j);
+   producers.shrink(i - j);
    survivedFetchClauses = j;
    lastFetch = Super::stat.conflicts;
 }
@@ -258,17 +265,23 @@ inline void ctsat::ConflictExchange<Database, Connector, PropEngine>::cleanNonCo
          if (Super::ig.locked(c)
             || age < numConflictsTillDelete
             || (c.lbd() < 4 && age < (5-c.lbd()) * numConflictsTillDelete))
+         {
+            nonConflProducers[j] = nonConflProducers[i];
             nonConflClauses[j++] = nonConflClauses[i];
-         else
+         } else
          {
+            Super::conn.reportImportUse(nonConflProducers[i], 0, 1);
             --Super::stat.nHoldBackImported;
+            Super::drat.removeClause(c);
             Super::db.remove(nonConflClauses[i]);
             propEngine.detachClause(nonConflClauses[i]);  // no actual remove, wait for garbage collect
          }
-      }
+      } else if (c.getExport() == 1)  // promoted by clauseUsedInConflict
+         Super::conn.reportImportUse(nonConflProducers[i], 1, 0);
    }
 
    nonConflClauses.shrink(i - j);
+   nonConflProducers.shrink(i - j);
    lastcleanUp = Super::stat.conflicts;
 }
 
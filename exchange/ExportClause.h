@@ -9,10 +9,15 @@
 #define EXCHANGE_EXPORTCLAUSE_H_
 
 
+#include <cassert>
 #include <cstdint>
+#include "mtl/Vec.h"
+#include "mtl/Sort.h"
 
 namespace ctsat
 {
+// A clause in the exchange buffers. The literals are sorted and stored as LEB128 coded differences
+// to their predecessor, which takes about half the bytes of plain literals.
 template <typename Database>
 struct ExportClause
 {
@@ -26,21 +31,78 @@ struct ExportClause
 
    uint16_t id;
    uint16_t lbd;
-   int const sz;
-   Lit clause[1];
-   ExportClause(Clause const & c, unsigned const lbd, unsigned const id);
+   uint32_t hash;  // computeHash() of the literals
+   uint16_t sz;
+   uint16_t nDataBytes;
+   uint8_t data[4];
+   ExportClause(vec<uint8_t> const & encoded, int const sz, unsigned const lbd, unsigned const id,
+                uint32_t const hash);
    ExportClause(ExportClause<Database> const & in);
-   ExportClause(Lit const & l, unsigned const id);
-   static uint64_t nbytes(Clause const & c);
-   static uint64_t nbytes(Lit const & l);
+   static uint64_t nbytes(vec<uint8_t> const & encoded);
    static uint64_t nbytes(ExportClause<Database> const & c);
    int size() const
    {
       return sz;
    }
-   Lit const & operator[](int const idx) const
+
+   // Writes the literals of c in the format of data to out. tmp is used for sorting.
+   template <typename VecType>
+   static void encode(VecType const & c, vec<uint32_t> & tmp, vec<uint8_t> & out)
+   {
+      tmp.clear();
+      for (int i = 0; i < c.size(); ++i)
+         tmp.push(c[i].toInt());
+      sort(tmp);
+      out.clear();
+      uint32_t prev = 0;
+      for (int i = 0; i < tmp.size(); ++i)
+      {
+         uint32_t d = tmp[i] - prev;
+         prev = tmp[i];
+         while (d > 127u)
+         {
+            out.push(128u | (d & 127u));
+            d >>= 7u;
+         }
+         out.push(d);
+      }
+   }
+
+   // Appends the literals to out.
+   template <typename VecType>
+   void decode(VecType & out) const
+   {
+      uint8_t const * p = data;
+      uint32_t lit = 0;
+      for (int i = 0; i < sz; ++i)
+      {
+         uint32_t d = 0;
+         unsigned shift = 0;
+         uint8_t b;
+         do
+         {
+            b = *p++;
+            d |= static_cast<uint32_t>(b & 127u) << shift;
+            shift += 7;
+         } while (b & 128u);
+         lit += d;
+         out.push(Lit::toLit(lit));
+      }
+      assert(p == data + nDataBytes);
+   }
+
+   // Independent of the order of the literals.
+   template <typename VecType>
+   static uint32_t computeHash(VecType const & c)
    {
-      return clause[idx];
+      uint64_t h = 0;
+      for (int i = 0; i < c.size(); ++i)
+      {
+         uint64_t const x = (static_cast<uint64_t>(c[i].toInt()) + 1) * 0x9E3779B97F4A7C15ull;
+         h += x ^ (x >> 32);
+      }
+      h = (h ^ c.size()) * 0xFF51AFD7ED558CCDull;
+      return static_cast<uint32_t>(h ^ (h >> 32));
    }
 
    void set(Clause & c, bool const minimizeClause) const
@@ -52,7 +114,4 @@ struct ExportClause
 
 }
 
-
-
-
 #endif /* EXCHANGE_EXPORTCLAUSE_H_ */
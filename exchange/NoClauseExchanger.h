@@ -42,6 +42,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "initial/SolverConfig.h"
 #include "mtl/Vec.h"
 #include "database/BasicTypes.h"
+#include "utils/DratPrint.h"
 
 namespace ctsat
 {
@@ -59,7 +60,8 @@ class NoClauseExchanger
                      Database & db,
                      ImplicationGraph<Database> & ig,
                      Connector & conn,
-                     PropEngine & propEngine);
+                     PropEngine & propEngine,
+                     DratPrint<Lit> & drat);
    ~NoClauseExchanger();
 
    bool setFinished(lbool const res);
@@ -103,6 +105,7 @@ class NoClauseExchanger
    bool ok;
    Statistic & stat;
    Connector & conn;
+   DratPrint<Lit> & drat;
 };
 
 template <typename Database, typename Connector, typename PropEngine>
@@ -134,10 +137,12 @@ inline NoClauseExchanger<Database, Connector, PropEngine>::NoClauseExchanger(
                                                                              ImplicationGraph<
                                                                                    Database> & ig,
                                                                              Connector & conn,
-                                                                             PropEngine & propEngine)
+                                                                             PropEngine & propEngine,
+                                                                             DratPrint<Lit> & drat)
       : ok(true),
         stat(stat),
-        conn(conn)
+        conn(conn),
+        drat(drat)
 {
 
 }
@@ -36,12 +36,16 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #ifndef SOURCES_PARALLEL_SIMPLECLAUSEEXCHANGER_H_
 #define SOURCES_PARALLEL_SIMPLECLAUSEEXCHANGER_H_
 
+#include <algorithm>
+#include <cstring>
+
 #include "exchange/NoClauseExchanger.h"
 #include "core/ImplicationGraph.h"
 #include "core/Statistic.h"
 #include "initial/SolverConfig.h"
 #include "initial/Inputs.h"
 #include "mtl/Vec.h"
+#include "utils/Timer.h"
 #include "exchange/ExportClause.h"
 
 namespace ctsat
@@ -65,7 +69,8 @@ class SimpleClauseExchanger : public NoClauseExchanger<Database, Connector, Prop
                          Database & db,
                          ImplicationGraph<Database> & ig,
                          Connector & conn,
-                         PropEngine & propEngine);
+                         PropEngine & propEngine,
+                         DratPrint<Lit> & drat);
    ~SimpleClauseExchanger();
 
    void clauseLearnt(CRef const ref);
@@ -85,13 +90,27 @@ class SimpleClauseExchanger : public NoClauseExchanger<Database, Connector, Prop
    int max_export_lbd;
    int max_import_lbd;
    int max_export_sz;
+   int const exportLbdLimit;  // the configured export limits, which are never exceeded
+   int const exportSzLimit;
+   int flowLbdLimit;   // limits of the flow control
+   int flowSzLimit;
+   int usageLbdLimit;  // limits derived from the use of the exports by other threads
+   int usageSzLimit;
+   double const exportUsefulRate;
+   Timer usageTimer;
    const unsigned id;
    size_type curReadPos;
    Database & db;
    ImplicationGraph<Database> & ig;
    vec<Lit> units;
    vec<CRef> clauses;
+   vec<unsigned> clauseProducers;  // the id of the exporter of each clause in clauses
    vec<Lit> tmpClause;
+   vec<uint32_t> sortTmp;
+   vec<uint8_t> encoded;
+   vec<uint32_t> ownHashes;  // hashes of the clauses this thread tried to export, by the low bits
+
+   static const uint32_t ownHashMask = (1 << 14) - 1;
 
    bool prepClause(vec<Lit> & preped, ExClause const & c)
    {
@@ -100,28 +119,95 @@ class SimpleClauseExchanger : public NoClauseExchanger<Database, Connector, Prop
       // 3 remove set lits
       // 4. return true, when clause is sat
       preped.clear();
-      for (int i = 0; i < c.size(); ++i)
+      c.decode(preped);
+      int j = 0;
+      for (int i = 0; i < preped.size(); ++i)
       {
-         lbool const val = ig.value(c[i]);
-         if (val.isUndef() || ig.level(c[i].var()) > 0)
-            preped.push(c[i]);
+         lbool const val = ig.value(preped[i]);
+         if (val.isUndef() || ig.level(preped[i].var()) > 0)
+            preped[j++] = preped[i];
          else if (val.isTrue())
             return true;
       }
+      preped.shrink(preped.size() - j);
       return false;
    }
 
    template <typename ... Args>
    bool exportClause(uint64_t const nBytes, Args ... args)
    {
-      bool const exported = Super::conn.template exchange<ExClause, Args...>(nBytes, args...);
+      bool const exported = Super::conn.template exchange<ExClause, Args...>(id, nBytes, args...);
       ++Super::stat.nSendClauses;
+      Super::stat.nSendBytes += nBytes;
       Super::stat.nLostClauses += !exported;
       return exported;
    }
 
    bool exportClause(Clause const & c);
 
+   template <typename VecType>
+   bool exportEncoded(VecType const & c, unsigned const lbd, uint32_t const hash)
+   {
+      ExClause::encode(c, sortTmp, encoded);
+      return exportClause<vec<uint8_t> const &, int const, unsigned const, unsigned const,
+            uint32_t const>(ExClause::nbytes(encoded), encoded, c.size(), lbd, id, hash);
+   }
+
+   // Returns true, when another thread exported the clause recently. Also remembers the clause as
+   // one this thread already has, so its imports are skipped.
+   bool isDuplicateExport(uint32_t const hash)
+   {
+      ownHashes[hash & ownHashMask] = hash;
+      bool const res = Super::conn.filterExport(hash);
+      Super::stat.nFilteredExports += res;
+      return res;
+   }
+
+   bool hasOwnCopy(ExClause const & c)
+   {
+      bool const res = ownHashes[c.hash & ownHashMask] == c.hash;
+      Super::stat.nFilteredImports += res;
+      return res;
+   }
+
+   // Flow control: grows the exchange buffer of this thread, when the slowest reader is behind by
+   // half of it. Once it can not grow anymore, the export limits are tightened instead. They are
+   // relaxed again, when the readers caught up.
+   // Usage control: once per second, the limits are tightened, when less than 5% of the imported
+   // exports were used in conflicts or more than twice exportUsefulRate were used per second.
+   // They are relaxed, when less than exportUsefulRate were used.
+   // The export limits are the tighter ones of both.
+   void adaptExportLimits();
+
+   // Returns false, when the limits can not be tightened any further.
+   bool tightenLimits(int & lbd, int & sz) const
+   {
+      if (lbd <= 2 && sz <= 8)
+         return false;
+      lbd = std::max(2, lbd - 1);
+      sz = std::max(8, sz * 3 / 4);
+      return true;
+   }
+
+   void relaxLimits(int & lbd, int & sz) const
+   {
+      lbd = std::min(exportLbdLimit, lbd + 1);
+      sz = std::min(exportSzLimit, sz + 2);
+   }
+
+   // Adds a copy of an exported or imported clause to the proof of this thread followed by a sync
+   // point. The exported copies are never deleted, so an importing thread can add its copy at any
+   // later sync point.
+   template <typename VecType>
+   void addProofCopy(VecType const & c)
+   {
+      if (Super::drat.isActive())
+      {
+         Super::drat.addClause(c);
+         Super::drat.addSyncPoint(Super::conn.getProofSyncPoint());
+      }
+   }
+
 };
 template <typename Database, typename Connector, typename PropEngine>
 inline bool SimpleClauseExchanger<Database, Connector, PropEngine>::shouldFetch() const
@@ -132,8 +218,11 @@ inline bool SimpleClauseExchanger<Database, Connector, PropEngine>::shouldFetch(
 template <typename Database, typename Connector, typename PropEngine>
 bool SimpleClauseExchanger<Database, Connector, PropEngine>::exportClause(Clause const & c)
 {
-   return exportClause<Clause const &, unsigned const, unsigned const>(ExportClause<Database>::nbytes(c),
-                                                                c, c.lbd(), id);
+   uint32_t const hash = ExClause::computeHash(c);
+   if (isDuplicateExport(hash))
+      return false;
+   addProofCopy(c);
+   return exportEncoded(c, c.lbd(), hash);
 }
 
 template <typename Database, typename Connector, typename PropEngine>
@@ -142,7 +231,8 @@ void SimpleClauseExchanger<Database, Connector, PropEngine>::fetchClauses()
    while (Super::conn.isValid(curReadPos))
    {
       ExClause const & importCl = Super::conn.template get<ExClause>(curReadPos);
-      if (importCl.id != id && importCl.lbd <= max_import_lbd && !prepClause(tmpClause, importCl))
+      if (importCl.id != id && importCl.lbd <= max_import_lbd && !hasOwnCopy(importCl)
+         && !prepClause(tmpClause, importCl))
       {
          if (tmpClause.size() < 2)
          {
@@ -151,17 +241,53 @@ void SimpleClauseExchanger<Database, Connector, PropEngine>::fetchClauses()
                Super::ok = false;
                return;
             }
+            addProofCopy(tmpClause);
             units.push(tmpClause[0]);
          } else
          {
+            addProofCopy(tmpClause);
             CRef const ref = db.alloc(tmpClause, true);
             importCl.set(db[ref], minimize_import_cl);
             clauses.push(ref);
+            clauseProducers.push(importCl.id);
          }
          ++Super::stat.nReceivedClauses;
       }
       curReadPos = Super::conn.next(curReadPos);
    }
+   Super::stat.nLostClauses += Super::conn.takeLostClauses(curReadPos);
+   adaptExportLimits();
+}
+
+template <typename Database, typename Connector, typename PropEngine>
+void SimpleClauseExchanger<Database, Connector, PropEngine>::adaptExportLimits()
+{
+   double const fill = Super::conn.exportFillLevel(id);
+   if (fill > 0.5)
+   {
+      if (Super::conn.growExportBuffer(id))
+         ++Super::stat.nExportBufferGrown;
+      else if (tightenLimits(flowLbdLimit, flowSzLimit))
+         ++Super::stat.nExportLimitTightened;
+   } else if (fill < 0.25)
+      relaxLimits(flowLbdLimit, flowSzLimit);
+
+   if (exportUsefulRate > 0 && usageTimer.isOver())
+   {
+      uint64_t nUsed, nUnused;
+      Super::conn.takeExportUse(id, nUsed, nUnused);
+      double const rate = nUsed / usageTimer.getPassedTime();
+      usageTimer.reset();
+      if (nUsed + nUnused > 0 && (20 * nUsed < nUsed + nUnused || rate > 2 * exportUsefulRate))
+      {
+         if (tightenLimits(usageLbdLimit, usageSzLimit))
+            ++Super::stat.nExportLimitTightenedByUse;
+      } else if (rate < exportUsefulRate)
+         relaxLimits(usageLbdLimit, usageSzLimit);
+   }
+
+   max_export_lbd = std::min(flowLbdLimit, usageLbdLimit);
+   max_export_sz = std::min(flowSzLimit, usageSzLimit);
 }
 
 template <typename Database, typename Connector, typename PropEngine>
@@ -182,35 +308,36 @@ inline void SimpleClauseExchanger<Database, Connector, PropEngine>::clauseLearnt
 template <typename Database, typename Connector, typename PropEngine>
 inline void SimpleClauseExchanger<Database, Connector, PropEngine>::unitLearnt(const Lit l)
 {
-   exportClause<Lit const &, unsigned const>(ExClause::nbytes(l), l, id);
+   vec<Lit> const unit(1, l);
+   uint32_t const hash = ExClause::computeHash(unit);
+   if (isDuplicateExport(hash))
+      return;
+   addProofCopy(unit);
+   exportEncoded(unit, 0, hash);
 }
 
 template <typename Database>
-ExportClause<Database>::ExportClause(Clause const & c, unsigned const lbd, unsigned const id)
+ExportClause<Database>::ExportClause(vec<uint8_t> const & encoded, int const sz, unsigned const lbd,
+                                     unsigned const id, uint32_t const hash)
       : id(id),
         lbd(lbd),
-        sz(c.size())
+        hash(hash),
+        sz(sz),
+        nDataBytes(encoded.size())
 {
-   for (int i = 0; i < sz; ++i)
-      clause[i] = c[i];
+   assert(sz < (1 << 16) && encoded.size() < (1 << 16));
+   memcpy(data, &encoded[0], nDataBytes);
 }
 
 template <typename Database>
 ExportClause<Database>::ExportClause(ExportClause<Database> const & c)
       : id(c.id),
         lbd(c.lbd),
-        sz(c.size())
-{
-   for (int i = 0; i < sz; ++i)
-      clause[i] = c[i];
-}
-template <typename Database>
-ExportClause<Database>::ExportClause(Lit const & l, unsigned const id)
-      : id(id),
-        lbd(0),
-        sz(1)
+        hash(c.hash),
+        sz(c.sz),
+        nDataBytes(c.nDataBytes)
 {
-   clause[0] = l;
+   memcpy(data, c.data, nDataBytes);
 }
 
 template <typename Database, typename Connector, typename PropEngine>
@@ -221,16 +348,26 @@ inline SimpleClauseExchanger<Database, Connector, PropEngine>::SimpleClauseExcha
                                                                                      ImplicationGraph<
                                                                                            Database>& ig,
                                                                                      Connector & conn,
-                                                                                     PropEngine & propEngine)
-      : Super(config, stat, db, ig, conn, propEngine),
+                                                                                     PropEngine & propEngine,
+                                                                                     DratPrint<Lit> & drat)
+      : Super(config, stat, db, ig, conn, propEngine, drat),
         minimize_import_cl(config.minimize_import_cl),
         max_export_lbd(config.max_export_lbd),
         max_import_lbd(config.max_import_lbd),
         max_export_sz(config.max_export_sz),
+        exportLbdLimit(config.max_export_lbd),
+        exportSzLimit(config.max_export_sz),
+        flowLbdLimit(config.max_export_lbd),
+        flowSzLimit(config.max_export_sz),
+        usageLbdLimit(config.max_export_lbd),
+        usageSzLimit(config.max_export_sz),
+        exportUsefulRate(config.exportUsefulRate),
+        usageTimer(1.0),
         id(conn.getUniqueId()),
         curReadPos(Connector::startPos()),
         db(db),
-        ig(ig)
+        ig(ig),
+        ownHashes(ownHashMask + 1, 0)
 {
 }
 
@@ -239,22 +376,17 @@ inline SimpleClauseExchanger<Database, Connector, PropEngine>::~SimpleClauseExch
 {
 }
 
+// The data is padded to a multiple of four bytes, the word size of the exchange buffers.
 template <typename Database>
-inline uint64_t ExportClause<Database>::nbytes(const Clause& c)
+inline uint64_t ExportClause<Database>::nbytes(vec<uint8_t> const & encoded)
 {
-   return sizeof(ExportClause<Database> ) + (c.size() - 1) * sizeof(Lit);
+   return sizeof(ExportClause<Database> ) - sizeof(data) + (encoded.size() + 3) / 4 * 4;
 }
 
 template <typename Database>
 inline uint64_t ExportClause<Database>::nbytes(const ExportClause<Database>& c)
 {
-   return sizeof(ExportClause<Database> ) + (c.size() - 1) * sizeof(Lit);
-}
-
-template <typename Database>
-inline uint64_t ExportClause<Database>::nbytes(const Lit& l)
-{
-   return sizeof(ExportClause<Database> );
+   return sizeof(ExportClause<Database> ) - sizeof(c.data) + (c.nDataBytes + 3) / 4 * 4;
 }
 
 template <typename Database, typename Connector, typename PropEngine>
@@ -266,6 +398,7 @@ inline std::tuple<bool,typename SimpleClauseExchanger<Database, Connector, PropE
    {
       res = clauses.last();
       clauses.pop();
+      clauseProducers.pop();
    }
    return std::make_tuple(false,res);
 }
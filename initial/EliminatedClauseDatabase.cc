@@ -35,43 +35,117 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "EliminatedClauseDatabase.h"
 
+#include <cstring>
+#include <vector>
+
 namespace ctsat
 {
 
-void EliminatedClauseDatabase::printModel(vec<lbool> & model) const
+static size_t const modelBufferSize = 1 << 22;
+
+static char * writeUnsigned(char * pos, unsigned v)
 {
-   printf("v ");
-   for (int i = 0; i < model.size(); i++)
-      if (!model[i].isUndef())
-         printf("%s%s%d", (i == 0) ? "" : " ", (model[i].isTrue()) ? "" : "-", i + 1);
-   printf(" 0\n");
+   char digits[10];
+   int n = 0;
+   do
+   {
+      digits[n++] = '0' + v % 10;
+      v /= 10;
+   } while (v > 0);
+   while (n > 0)
+      *pos++ = digits[--n];
+   return pos;
 }
 
-void EliminatedClauseDatabase::addElimClause(Var const v, const Clause& c)
+void EliminatedClauseDatabase::printModel(vec<lbool> & model, FILE * out, bool const binary) const
 {
+   std::vector<char> buf(modelBufferSize);
+   char * pos = buf.data();
+   char * const end = buf.data() + buf.size();
+   if (binary)
+   {
+      uint64_t const nVars = model.size();
+      memcpy(pos, "CTSATMDL", 8);
+      memcpy(pos + 8, &nVars, sizeof(nVars));
+      pos += 8 + sizeof(nVars);
+      for (int i = 0; i < model.size(); ++i)
+      {
+         if (pos == end)
+         {
+            fwrite(buf.data(), 1, pos - buf.data(), out);
+            pos = buf.data();
+         }
+         *pos++ = (model[i].isUndef()) ? 0 : (model[i].isTrue()) ? 1 : -1;
+      }
+   } else
    {
-      int first = elimclauses.size();
-      int v_pos = -1;
+      *pos++ = 'v';
+      for (int i = 0; i < model.size(); ++i)
+      {
+         if (model[i].isUndef())
+            continue;
+         if (end - pos < 16)
+         {
+            fwrite(buf.data(), 1, pos - buf.data(), out);
+            pos = buf.data();
+         }
+         *pos++ = ' ';
+         if (model[i].isFalse())
+            *pos++ = '-';
+         pos = writeUnsigned(pos, i + 1);
+      }
+      memcpy(pos, " 0\n", 3);
+      pos += 3;
+   }
+   fwrite(buf.data(), 1, pos - buf.data(), out);
+   fflush(out);
+}
+
+template <typename C>
+static void addElimClauseTo(vec<uint32_t> & elimclauses, Var const v, C const & c)
+{
+   int first = elimclauses.size();
+   int v_pos = -1;
 
 // Copy clause to elimclauses-vector. Remember position where the
 // variable 'v' occurs:
-      for (int i = 0; i < c.size(); i++)
-      {
-         elimclauses.push(c[i].toInt());
-         if (c[i].var() == v)
-            v_pos = i + first;
-      }
-      assert(v_pos != -1);
+   for (int i = 0; i < c.size(); i++)
+   {
+      elimclauses.push(c[i].toInt());
+      if (c[i].var() == v)
+         v_pos = i + first;
+   }
+   assert(v_pos != -1);
 
 // Swap the first literal with the 'v' literal, so that the literal
 // containing 'v' will occur first in the clause:
-      uint32_t tmp = elimclauses[v_pos];
-      elimclauses[v_pos] = elimclauses[first];
-      elimclauses[first] = tmp;
+   uint32_t tmp = elimclauses[v_pos];
+   elimclauses[v_pos] = elimclauses[first];
+   elimclauses[first] = tmp;
 
 // Store the length of the clause last:
-      elimclauses.push(c.size());
-   }
+   elimclauses.push(c.size());
+}
+
+void EliminatedClauseDatabase::addElimClause(Var const v, const Clause& c)
+{
+   addElimClauseTo(elimclauses, v, c);
+}
+
+void EliminatedClauseDatabase::addElimClause(Var const v, vec<Lit> const & c)
+{
+   addElimClauseTo(elimclauses, v, c);
+}
+
+void EliminatedClauseDatabase::addElimEquivalence(Var const v, Lit const r)
+{
+   // the clauses (v | ~r) and (~v | r), each with the literal of v first
+   elimclauses.push(Lit(v, false).toInt());
+   elimclauses.push((~r).toInt());
+   elimclauses.push(2);
+   elimclauses.push(Lit(v, true).toInt());
+   elimclauses.push(r.toInt());
+   elimclauses.push(2);
 }
 
 void EliminatedClauseDatabase::extendModel(vec<lbool> & model) const
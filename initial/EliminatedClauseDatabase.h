@@ -37,6 +37,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define SOURCES_SIMP_ELIMINATEDCLAUSEDATABASE_H_
 
 #include <cstdint>
+#include <cstdio>
 #include "mtl/Vec.h"
 #include "database/MinisatAllocatorDb.h"
 
@@ -51,13 +52,22 @@ class EliminatedClauseDatabase
  public:
 
    void addElimClause(Var const v, Clause const & c);
+   void addElimClause(Var const v, vec<Lit> const & c);
    void addElimUnit(Lit const & l);
+   // v was substituted by the equivalent literal r
+   void addElimEquivalence(Var const v, Lit const r);
 
-   void printModel(vec<lbool> & model) const;
+   // Writes the model as "v" line or in the binary format: "CTSATMDL", the number of variables as
+   // 64 bit integer and one byte per variable (1 true, -1 false, 0 unassigned).
+   void printModel(vec<lbool> & model, FILE * out = stdout, bool const binary = false) const;
    void extendModel(vec<lbool> & model) const;
 
    double mBytes() const;
 
+   // The flat representation of the eliminated clauses (used by the instance cache).
+   vec<uint32_t> const & data() const;
+   void assign(vec<uint32_t> const & data);
+
  private:
    vec<uint32_t> elimclauses;
 
@@ -70,6 +80,16 @@ inline double EliminatedClauseDatabase::mBytes() const
    return static_cast<double>(elimclauses.size() * sizeof(uint32_t)) / (1024.0 * 1024.0);
 }
 
+inline vec<uint32_t> const & EliminatedClauseDatabase::data() const
+{
+   return elimclauses;
+}
+
+inline void EliminatedClauseDatabase::assign(vec<uint32_t> const & data)
+{
+   data.copyTo(elimclauses);
+}
+
 inline void EliminatedClauseDatabase::addElimUnit(const Lit& l)
 {
    elimclauses.push(l.toInt());
@@ -98,6 +98,10 @@ IntOption Inputs::nThreads(_parallel, "nthreads", "number of threads to run in p
 DoubleOption Inputs::mbExchangeBufferPerThread(
       _parallel, "mb-exchange", "number of mega bytes per thread to use for clause exchange buffer",
       1.0, DoubleRange(0.01, true, HUGE_VAL, false));
+DoubleOption Inputs::mbExchangeBufferMax(
+      _parallel, "mb-exchange-max",
+      "number of mega bytes per thread the clause exchange buffer may grow to, when readers fall behind",
+      64.0, DoubleRange(0.01, true, HUGE_VAL, false));
 IntOption Inputs::max_export_lbd(_parallel, "exp-lbd",
                                  "Maximal allowed lbd of a clause to be exported", 5,
                                  IntRange(1, 10));
@@ -112,6 +116,21 @@ IntOption Inputs::numConflictsToDelete(
       _parallel, "nconfl-to-delete",
       "Number of conflicts after import the clause is deleted when unused", 15000,
       IntRange(1, INT32_MAX));
+DoubleOption Inputs::exportUsefulRate(
+      _parallel, "exp-useful-rate",
+      "Target number of exported clauses per thread and second, which other threads use in conflicts (0 = off)",
+      100.0, DoubleRange(0, true, HUGE_VAL, false));
+BoolOption Inputs::cube(
+      _parallel, "cube",
+      "Split the search space into cubes, which the threads solve under assumptions, instead of running a portfolio",
+      false);
+IntOption Inputs::cubeConflicts(
+      _parallel, "cube-confl",
+      "Number of conflicts a thread works on a cube, before it checks for idle threads to split it for",
+      5000, IntRange(1, INT32_MAX));
+IntOption Inputs::cubeMaxSize(_parallel, "cube-max-size",
+                              "Cubes with this number of literals are not split any further", 40,
+                              IntRange(1, INT32_MAX));
 BoolOption Inputs::minimize_import_cl(_parallel, "min-import-cl",
                                       "Allows minimization of imported clauses", false);
 
@@ -165,6 +184,21 @@ IntOption Inputs::maxFullImplicationMinLbd(_min, "max-full-impl",
 
 BoolOption Inputs::useVivification(_min, "vivi",
                                    "Uses vivification during restart to minimize clauses", true);
+DoubleOption Inputs::viviLocalEffort(
+      _min, "vivi-local-eff",
+      "Propagations spent on vivifying local learnt clauses relative to the search propagations",
+      0.1, DoubleRange(0.0, true, HUGE_VAL, false));
+BoolOption Inputs::useProbing(_min, "probe",
+                              "Probes roots of the binary implication graph during restart", true);
+DoubleOption Inputs::probeEffort(
+      _min, "probe-eff", "Propagations spent on probing relative to the search propagations", 0.05,
+      DoubleRange(0.0, true, HUGE_VAL, false));
+BoolOption Inputs::useLearntSubsumption(_min, "learnt-sub",
+                                        "Removes subsumed learnt clauses during restart", true);
+DoubleOption Inputs::learntSubEffort(
+      _min, "learnt-sub-eff",
+      "Occurrences visited by learnt clause subsumption relative to the search propagations", 0.1,
+      DoubleRange(0.0, true, HUGE_VAL, false));
 BoolOption Inputs::remove_satisfied(_min, "rm-satisfied",
                                    "Removes satisfied clauses", true);
 
@@ -220,6 +254,37 @@ DoubleOption Inputs::simp_garbage_frac(
       "simp-gc-frac",
       "The fraction of wasted memory allowed before a garbage collection is triggered during simplification.",
       0.4, DoubleRange(0, false, HUGE_VAL, false));
+BoolOption Inputs::equivalences(_simp, "equiv",
+                                "Substitute equivalent literals of the binary implication graph.",
+                                true);
+BoolOption Inputs::gates(_simp, "gates",
+                         "Resolve only gate against non-gate clauses during variable elimination.",
+                         true);
+IntOption Inputs::gateXorLimit(_simp, "gate-xor-lim", "Maximal number of inputs of xor gates.", 4,
+                               IntRange(1, 8));
+BoolOption Inputs::blockedElim(_simp, "bce", "Remove blocked clauses before variable elimination.",
+                               true);
+BoolOption Inputs::coveredElim(_simp, "cce",
+                               "Also remove covered clauses (requires bce).", false);
+IntOption Inputs::blockedElimSteps(_simp, "bce-steps",
+                                   "Maximal number of literal visits of blocked clause elimination",
+                                   100000000, IntRange(0, INT32_MAX));
+BoolOption Inputs::gauss(_simp, "gauss",
+                         "Gauss-Jordan elimination on the xor constraints of the input during search.",
+                         true);
+IntOption Inputs::xorMaxSize(_simp, "xor-size",
+                             "Maximal size of the xor constraints detected in the clauses.", 6,
+                             IntRange(3, 10));
+BoolOption Inputs::inproElim(_simp, "inpro-elim",
+                             "Perform variable elimination on touched variables during search.",
+                             true);
+IntOption Inputs::inproElimSteps(_simp, "inpro-elim-steps",
+                                 "Maximal number of steps of one inprocessing elimination round",
+                                 10000000, IntRange(0, INT32_MAX));
+IntOption Inputs::inproElimInterval(
+      _simp, "inpro-elim-int",
+      "Number of clause simplification rounds between two inprocessing elimination rounds", 2,
+      IntRange(1, INT32_MAX));
 
 const char* _main = "MAIN";
 IntOption Inputs::verb(_main, "verb", "Verbosity level (0=silent, 1=some, 2=more).", 1,
@@ -253,7 +318,14 @@ BoolOption Inputs::verifySat(_main, "verify-sat",
                              "On sat answere, the solution is checked against the dimacs file.",
                              false);
 BoolOption Inputs::model(_main, "model", "Print the SAT model", true);
+StringOption Inputs::modelFile(_main, "model-file", "Write the SAT model to this file instead of stdout.", "");
+BoolOption Inputs::modelBinary(_main, "model-binary",
+                               "Write the SAT model in a binary format (one byte per variable).", false);
 StringOption Inputs::drat_file(_main, "drat-file", "DRAT UNSAT proof ouput file.", "");
+BoolOption Inputs::dratBinary(_main, "drat-binary", "Write the DRAT proof in the binary format.", true);
+StringOption Inputs::cacheDir(_main, "cache-dir",
+                              "Directory of the binary cache of preprocessed instances (disabled if empty).",
+                              "");
 
 int * Inputs::argc = nullptr;
 char *** Inputs::argv = nullptr;
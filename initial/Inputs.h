@@ -88,11 +88,27 @@ class Inputs
 
    static BoolOption remove_satisfied;
    static BoolOption useVivification;
+   static DoubleOption viviLocalEffort;
+   static BoolOption useProbing;
+   static DoubleOption probeEffort;
+   static BoolOption useLearntSubsumption;
+   static DoubleOption learntSubEffort;
    static BoolOption use_elim;
    static IntOption grow;
    static IntOption clause_lim;
    static IntOption subsumption_lim;
    static DoubleOption simp_garbage_frac;
+   static BoolOption equivalences;
+   static BoolOption gates;
+   static IntOption gateXorLimit;
+   static BoolOption blockedElim;
+   static BoolOption coveredElim;
+   static IntOption blockedElimSteps;
+   static BoolOption gauss;
+   static IntOption xorMaxSize;
+   static BoolOption inproElim;
+   static IntOption inproElimSteps;
+   static IntOption inproElimInterval;
 
    static IntOption verb;
    static IntOption secToSwitchHeuristic;
@@ -102,7 +118,11 @@ class Inputs
 
    static BoolOption verifySat;
    static BoolOption model;
+   static StringOption modelFile;
+   static BoolOption modelBinary;
    static StringOption drat_file;
+   static BoolOption dratBinary;
+   static StringOption cacheDir;
 
    static BoolOption adaptiveThreadStart;
    static IntOption adaptiveThreadDisableBase;
@@ -114,8 +134,13 @@ class Inputs
    static IntOption max_import_lbd;
    static IntOption max_export_sz;
    static IntOption numConflictsToDelete;
+   static DoubleOption exportUsefulRate;
+   static BoolOption cube;
+   static IntOption cubeConflicts;
+   static IntOption cubeMaxSize;
 
    static DoubleOption mbExchangeBufferPerThread;
+   static DoubleOption mbExchangeBufferMax;
 
    static DoubleOption mpiMbBufferSize;
    static DoubleOption mpi_send_interval;
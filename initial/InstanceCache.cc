@@ -0,0 +1,264 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#include "initial/InstanceCache.h"
+#include "utils/MappedFile.h"
+
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+
+namespace ctsat
+{
+
+namespace
+{
+
+struct CacheHeader
+{
+   char magic[8];
+   uint32_t version;
+   uint32_t ok;
+   uint64_t contentHash;
+   uint64_t configHash;
+   uint64_t inputSize;
+   uint64_t nVars;  // size of model and isDecisionVar
+   uint64_t nClauses;
+   uint64_t nArenaBytes;
+   uint64_t nElimWords;
+   uint64_t nXorLits;
+   uint32_t extraClauseField;
+   uint32_t unused;
+};
+
+char const cacheMagic[8] = { 'C', 'T', 'S', 'A', 'T', 'P', 'I', 'C' };
+
+inline uint64_t mix(uint64_t h, uint64_t const x)
+{
+   h ^= x * 0x9E3779B97F4A7C15ull;
+   h = (h << 31) | (h >> 33);
+   return h * 0xC2B2AE3D27D4EB4Full;
+}
+
+uint64_t hashBytes(char const * data, size_t const size)
+{
+   uint64_t h = size;
+   size_t i = 0;
+   for (; i + 8 <= size; i += 8)
+   {
+      uint64_t x;
+      memcpy(&x, data + i, 8);
+      h = mix(h, x);
+   }
+   uint64_t rest = 0;
+   memcpy(&rest, data + i, size - i);
+   h = mix(h, rest);
+   return h ^ (h >> 29);
+}
+
+uint64_t hashDouble(uint64_t const h, double const d)
+{
+   uint64_t x;
+   memcpy(&x, &d, sizeof(x));
+   return mix(h, x);
+}
+
+// Copies n elements of the section at pos into out and advances pos.
+template <typename T>
+void readSection(char const * & pos, vec<T> & out, uint64_t const n)
+{
+   out.clear();
+   out.growTo(n);
+   if (n > 0)
+      memcpy(out.getData(), pos, n * sizeof(T));
+   pos += n * sizeof(T);
+}
+
+template <typename T>
+bool writeSection(FILE * f, vec<T> const & in)
+{
+   return in.size() == 0 || fwrite(in.getData(), sizeof(T), in.size(), f) == static_cast<size_t>(in.size());
+}
+
+}
+
+InstanceCache::InstanceCache(SolverConfig const & config)
+      : active(!config.cacheDir.empty() && config.drat_file.empty()),
+        hashed(false),
+        verb(config.verbosity),
+        configHash(version),
+        contentHash(0),
+        inputSize(0),
+        cacheDir(config.cacheDir)
+{
+   // All options changing the result of the preprocessor:
+   configHash = mix(configHash, config.elim);
+   configHash = mix(configHash, config.grow);
+   configHash = mix(configHash, config.clause_lim);
+   configHash = mix(configHash, config.subsumption_lim);
+   configHash = hashDouble(configHash, config.simp_garbage_frac);
+   configHash = mix(configHash, config.useEquivalences);
+   configHash = mix(configHash, config.useGates);
+   configHash = mix(configHash, config.gateXorLimit);
+   configHash = mix(configHash, config.useBlockedElim);
+   configHash = mix(configHash, config.useCoveredElim);
+   configHash = mix(configHash, config.blockedElimSteps);
+   configHash = mix(configHash, config.useGauss);
+   configHash = mix(configHash, config.xorMaxSize);
+}
+
+std::string InstanceCache::entryName() const
+{
+   char name[64];
+   snprintf(name, sizeof(name), "/%016llx-%016llx.ctsc", static_cast<unsigned long long>(contentHash),
+            static_cast<unsigned long long>(configHash));
+   return cacheDir + name;
+}
+
+bool InstanceCache::load(std::string const & filename, SatInstance & inst)
+{
+   hashed = false;
+   if (!active)
+      return false;
+   {
+      MappedFile input;
+      if (!input.open(filename))
+         return false;
+      contentHash = hashBytes(input.data(), input.size());
+      inputSize = input.size();
+      hashed = true;
+   }
+
+   MappedFile entry;
+   if (!entry.open(entryName()) || entry.size() < sizeof(CacheHeader))
+      return false;
+   CacheHeader h;
+   memcpy(&h, entry.data(), sizeof(h));
+   if (memcmp(h.magic, cacheMagic, sizeof(cacheMagic)) != 0 || h.version != version
+         || h.contentHash != contentHash || h.configHash != configHash || h.inputSize != inputSize
+         || entry.size()
+            != sizeof(h) + 2 * h.nVars + sizeof(CRef) * h.nClauses + h.nArenaBytes
+               + sizeof(uint32_t) * h.nElimWords + sizeof(Lit) * h.nXorLits)
+   {
+      if (verb > 0)
+         printf("c cache: ignoring invalid entry %s\n", entryName().c_str());
+      return false;
+   }
+
+   if (!h.ok)
+      inst = SatInstance();
+   else
+   {
+      char const * pos = entry.data() + sizeof(h);
+      SatInstance res;
+      vec<uint8_t> values;
+      readSection(pos, values, h.nVars);
+      res.model.growTo(h.nVars, lbool::Undef());
+      for (int i = 0; i < values.size(); ++i)
+         res.model[i] = lbool(values[i]);
+      readSection(pos, values, h.nVars);
+      res.isDecisionVar.growTo(h.nVars, false);
+      for (int i = 0; i < values.size(); ++i)
+         res.isDecisionVar[i] = values[i] != 0;
+      readSection(pos, res.clauses, h.nClauses);
+      res.ca = SatInstance::Database(pos, h.nArenaBytes);
+      res.ca.extra_clause_field = h.extraClauseField != 0;
+      pos += h.nArenaBytes;
+      vec<uint32_t> elim;
+      readSection(pos, elim, h.nElimWords);
+      res.elimDb.assign(elim);
+      readSection(pos, res.xors, h.nXorLits);
+      inst = std::move(res);
+   }
+   if (verb > 0)
+      printf("c cache: loaded %s\n", entryName().c_str());
+   return true;
+}
+
+void InstanceCache::store(SatInstance const & inst) const
+{
+   if (!active || !hashed)
+      return;
+   CacheHeader h;
+   memset(&h, 0, sizeof(h));
+   memcpy(h.magic, cacheMagic, sizeof(cacheMagic));
+   h.version = version;
+   h.ok = inst.isOk();
+   h.contentHash = contentHash;
+   h.configHash = configHash;
+   h.inputSize = inputSize;
+   if (inst.isOk())
+   {
+      h.nVars = inst.model.size();
+      h.nClauses = inst.clauses.size();
+      h.nArenaBytes = inst.ca.nBytes();
+      h.nElimWords = inst.elimDb.data().size();
+      h.nXorLits = inst.xors.size();
+      h.extraClauseField = inst.ca.extra_clause_field;
+   }
+
+   // Written to a temporary file first, so concurrent runs never see a partial entry:
+   std::string const name = entryName();
+   std::string const tmpName = name + ".tmp" + std::to_string(getpid());
+   FILE * f = fopen(tmpName.c_str(), "wb");
+   if (f == NULL)
+   {
+      if (verb > 0)
+         printf("c cache: could not write %s\n", tmpName.c_str());
+      return;
+   }
+   bool ok = fwrite(&h, sizeof(h), 1, f) == 1;
+   if (inst.isOk())
+   {
+      vec<uint8_t> values(inst.model.size());
+      for (int i = 0; i < inst.model.size(); ++i)
+         values[i] = inst.model[i].toInt();
+      ok = ok && writeSection(f, values);
+      for (int i = 0; i < inst.isDecisionVar.size(); ++i)
+         values[i] = inst.isDecisionVar[i];
+      ok = ok && writeSection(f, values) && writeSection(f, inst.clauses)
+         && fwrite(inst.ca.data(), 1, h.nArenaBytes, f) == h.nArenaBytes
+         && writeSection(f, inst.elimDb.data()) && writeSection(f, inst.xors);
+   }
+   ok = (fclose(f) == 0) && ok;
+   if (ok && std::rename(tmpName.c_str(), name.c_str()) == 0)
+   {
+      if (verb > 0)
+         printf("c cache: stored %s\n", name.c_str());
+   } else
+      std::remove(tmpName.c_str());
+}
+
+} /* namespace ctsat */
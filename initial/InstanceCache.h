@@ -0,0 +1,86 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef SOURCES_INITIAL_INSTANCECACHE_H_
+#define SOURCES_INITIAL_INSTANCECACHE_H_
+
+#include <cstdint>
+#include <string>
+
+#include "initial/SatInstance.h"
+#include "initial/SolverConfig.h"
+
+namespace ctsat
+{
+
+// Binary cache of preprocessed instances. A cache file holds the clause arena, the model,
+// isDecisionVar, the eliminated clauses and the xors of an instance. It is keyed by a hash of the
+// input file and of the preprocessor options, so repeated runs on the same input skip parsing
+// and preprocessing.
+class InstanceCache
+{
+ public:
+   // The cache is disabled, if no cache directory is given or a DRAT proof is written.
+   explicit InstanceCache(SolverConfig const & config);
+
+   bool isActive() const;
+
+   // Loads the cached instance of filename into inst. Returns false, if there is no valid entry.
+   bool load(std::string const & filename, SatInstance & inst);
+   // Writes inst as the entry of the file last passed to load().
+   void store(SatInstance const & inst) const;
+
+ private:
+   static uint32_t const version = 1;
+
+   bool active;
+   bool hashed;  // contentHash and inputSize belong to the last file passed to load()
+   int verb;
+   uint64_t configHash;
+   uint64_t contentHash;
+   uint64_t inputSize;
+   std::string cacheDir;
+
+   std::string entryName() const;
+};
+
+inline bool InstanceCache::isActive() const
+{
+   return active;
+}
+
+} /* namespace ctsat */
+
+#endif /* SOURCES_INITIAL_INSTANCECACHE_H_ */
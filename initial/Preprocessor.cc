@@ -39,7 +39,9 @@
 #include "Preprocessor.h"
 
 #include <cstdio>
-#include <zlib.h>
+#include <cstring>
+#include <utility>
+#include <vector>
 
 namespace ctsat
 {
@@ -47,11 +49,23 @@ namespace ctsat
 //=================================================================================================
 // Options:
 
+// The work units of the parallel parts. They do not depend on the number of threads, which keeps
+// the preprocessed instance independent of it.
+static size_t const parseChunkBytes = 1 << 22;
+static int const subsumeChunkSize = 1024;
+static int const elimBatchSize = 1024;
+
 //=================================================================================================
 // Constructor/Destructor:
 
 Preprocessor::Preprocessor(SolverConfig const & config)
       : elim(config.elim),
+        equiv(config.useEquivalences),
+        gates(config.useGates),
+        blockedElim(config.useBlockedElim),
+        coveredElim(config.useCoveredElim),
+        gauss(config.useGauss),
+        keepOriginal(config.keepOriginalClauses),
         ok(true),
         verb(config.verbosity),
         grow(config.grow),
@@ -61,12 +75,21 @@ Preprocessor::Preprocessor(SolverConfig const & config)
         bwdsub_assigns(0),
         n_touched(0),
         eliminated_vars(0),
+        gateXorLimit(config.gateXorLimit),
+        nAndGates(0),
+        nIteGates(0),
+        nXorGates(0),
+        blockedElimSteps(config.blockedElimSteps),
+        nBlockedClauses(0),
+        nCoveredClauses(0),
+        xorMaxSize(config.xorMaxSize),
         bwdsub_tmpunit(ClauseAllocator::npos()),
         simp_garbage_frac(config.simp_garbage_frac),
         occurs(ClauseDeleted(ca)),
         elim_heap(ElimLt(n_occ)),
+        workers(config.preproThreads),
         randEngine(config.rnd_seed),
-        drat(config.drat_file),
+        drat(config.drat_file, config.dratBinary),
         ca(),
         ig(ca),
         branch(Branch<ClauseAllocator>::BranchInputArgs(config, smode, randEngine, stat, ca, ig)),
@@ -75,6 +98,7 @@ Preprocessor::Preprocessor(SolverConfig const & config)
    vec<Lit> dummy(1, Lit::Undef());
    ca.extra_clause_field = true;
    bwdsub_tmpunit = ca.alloc(dummy, false);
+   gateMarks.growTo(workers.nThreads());
 }
 
 Preprocessor::~Preprocessor()
@@ -132,17 +156,174 @@ void Preprocessor::readInstance_clause(StreamBuffer & in, vec<Lit> & lits)
    }
 }
 
-bool Preprocessor::readInstance(std::string const & filename)
+// Parses a DIMACS integer, which has to be followed by white space or the end of the chunk.
+static inline int parseChunkInt(char const * & pos, char const * const end)
 {
-   double initial_time = cpuTime();
-   gzFile in = gzopen(filename.c_str(), "rb");
-   if (in == NULL)
-      printf("c ERROR! Could not open file: %s\n", filename.c_str()), throw InputException();
+   int const neg = *pos == '-';
+   pos += neg | (*pos == '+');
+   char const * const first = pos;
+   unsigned val = 0, digit;
+   while (pos < end && (digit = static_cast<unsigned char>(*pos) - '0') < 10)
+   {
+      val = val * 10 + digit;
+      ++pos;
+   }
+   if (pos == first || (pos < end && static_cast<unsigned char>(*pos) > ' '))
+      printf("PARSE ERROR! Unexpected char: %c\n", pos < end ? *pos : ' '), throw InputException();
+   return (static_cast<int>(val) ^ -neg) + neg;
+}
+
+// Parses the literals of a DIMACS chunk starting at a line begin into lits. Clauses are
+// terminated by 0 and may continue in the next chunk.
+static void parseChunk(char const * pos, char const * const end, vec<int> & lits, int & vars,
+                       int & clauses)
+{
+   for (;;)
+   {
+      while (pos < end && static_cast<unsigned char>(*pos) <= ' ')
+         ++pos;
+      if (pos == end)
+         break;
+      else if (*pos == 'c')
+      {
+         pos = static_cast<char const *>(memchr(pos, '\n', end - pos));
+         if (pos == nullptr)
+            break;
+      } else if (*pos == 'p')
+      {
+         if (end - pos < 6 || memcmp(pos, "p cnf ", 6) != 0)
+            printf("PARSE ERROR! Unexpected char: %c\n", *pos), throw InputException();
+         pos += 6;
+         while (pos < end && (*pos == ' ' || *pos == '\t'))
+            ++pos;
+         vars = parseChunkInt(pos, end);
+         while (pos < end && (*pos == ' ' || *pos == '\t'))
+            ++pos;
+         clauses = parseChunkInt(pos, end);
+      } else
+         lits.push(parseChunkInt(pos, end));
+   }
+}
+
+void Preprocessor::readInstance_chunks(char const * data, size_t const size, vec<vec<int>> & lits,
+                                       int & nHeaderVars, int & nHeaderClauses)
+{
+   // Split the input into chunks, which start at the beginning of a line:
+   std::vector<size_t> begins(1, 0);
+   while (begins.back() + parseChunkBytes < size)
+   {
+      char const * const nl = static_cast<char const *>(memchr(
+            data + begins.back() + parseChunkBytes - 1, '\n', size - begins.back() - parseChunkBytes + 1));
+      begins.push_back(nl == nullptr ? size : nl + 1 - data);
+   }
+   if (begins.back() < size)
+      begins.push_back(size);
+
+   int const nChunks = begins.size() - 1;
+   lits.growTo(nChunks);
+   vec<int> vars(nChunks, -1), clauses(nChunks, -1);
+   std::atomic<bool> failed(false);
+   workers.run(nChunks, [&](int const i, int)
+   {
+      try
+      {
+         parseChunk(data + begins[i], data + begins[i + 1], lits[i], vars[i], clauses[i]);
+      } catch (InputException &)
+      {
+         failed = true;
+      }
+   });
+   if (failed)
+      throw InputException();
 
-   StreamBuffer strb(in);
-   bool res = readInstance_main(strb);
+   for (int i = 0; i < nChunks; ++i)
+      if (vars[i] >= 0)
+      {
+         nHeaderVars = vars[i];
+         nHeaderClauses = clauses[i];
+      }
+}
+
+bool Preprocessor::readInstance_merge(vec<vec<int>> & lits, int const nHeaderVars,
+                                      int const nHeaderClauses)
+{
+   int cnt = 0;
+   vec<Lit> & ps = add_tmp;
+   ps.clear();
+   for (int i = 0; i < lits.size(); ++i)
+   {
+      for (int j = 0; j < lits[i].size(); ++j)
+      {
+         int const lit = lits[i][j];
+         if (lit == 0)
+         {
+            ++cnt;
+            if (!addClause(ps, true))
+               return false;
+            ps.clear();
+            continue;
+         }
+         Var const v = abs(lit) - 1;
+         while (v >= ig.nVars())
+            newVar();
+         ps.push(Lit(v, lit < 0));
+      }
+      lits[i].clear(true);
+   }
+   if (ps.size() > 0)
+      printf("PARSE ERROR! Unexpected end of file\n"), throw InputException();
+
+   if (nHeaderVars != ig.nVars())
+      fprintf(stderr, "c WARNING! DIMACS header mismatch: wrong number of variables.\n");
+   if (cnt != nHeaderClauses)
+      fprintf(stderr, "c WARNING! DIMACS header mismatch: wrong number of clauses.\n");
+   return true;
+}
 
-   gzclose(in);
+bool Preprocessor::readInstance_parallel(DecompressReader & in)
+{
+   std::vector<char> buf;
+   unsigned char const * block;
+   for (size_t n; (n = in.next(block)) > 0;)
+      buf.insert(buf.end(), block, block + n);
+
+   vec<vec<int>> lits;
+   int nHeaderVars = 0, nHeaderClauses = 0;
+   readInstance_chunks(buf.data(), buf.size(), lits, nHeaderVars, nHeaderClauses);
+   std::vector<char>().swap(buf);
+   return readInstance_merge(lits, nHeaderVars, nHeaderClauses);
+}
+
+bool Preprocessor::readInstance_mapped(MappedFile & file)
+{
+   vec<vec<int>> lits;
+   int nHeaderVars = 0, nHeaderClauses = 0;
+   readInstance_chunks(file.data(), file.size(), lits, nHeaderVars, nHeaderClauses);
+   file.close();
+   return readInstance_merge(lits, nHeaderVars, nHeaderClauses);
+}
+
+bool Preprocessor::readInstance(std::string const & filename)
+{
+   double initial_time = cpuTime();
+   bool res;
+   // Uncompressed files are parsed directly from a memory mapping:
+   MappedFile file;
+   if (file.open(filename) && !DecompressReader::isCompressed(file.data(), file.size()))
+      res = readInstance_mapped(file);
+   else
+   {
+      // Compressed files are decompressed on a background thread while being parsed:
+      file.close();
+      DecompressReader in(filename);
+      if (workers.nThreads() > 1)
+         res = readInstance_parallel(in);
+      else
+      {
+         StreamBuffer strb(in);
+         res = readInstance_main(strb);
+      }
+   }
    if (verb > 0)
    {
       printf("c ##############################   Initial  ############################\n");
@@ -160,7 +341,8 @@ bool Preprocessor::readInstance(std::string const & filename)
 SatInstance Preprocessor::getInstance(std::string const & filename)
 {
    Timer preprocessTime;
-   if (!readInstance(filename) || (elim && !eliminate()) || !removeRedundant(true))
+   if (!readInstance(filename) || (equiv && !substituteEquivalences()) || (elim && !eliminate())
+         || !removeRedundant(true))
       return SatInstance();
 
    // Force full cleanup (this is safe and desirable since it only happens once):
@@ -176,8 +358,15 @@ SatInstance Preprocessor::getInstance(std::string const & filename)
    }
 
 
+   vec<Lit> xors;
+   int const nXors = (gauss && !drat.isActive()) ? findXors(xors) : 0;
+   if (verb > 0 && nXors > 0)
+      printf("c xors: %d\n", nXors);
+
    SatInstance res(std::move(model), std::move(isDecisionVar), std::move(clauses), std::move(ca), std::move(elimDb),
                    std::move(drat));
+   res.xors = std::move(xors);
+   res.originalClauses = std::move(originalClauses);
    assert(res.isClean());
    printf("c #########################  after Preprocessor  #######################\n");
    printf("c nVars: %12d nCls:%12d    time:%3.2fs\n", ig.nVars() - ig.nAssigns() - eliminated_vars,
@@ -186,6 +375,85 @@ SatInstance Preprocessor::getInstance(std::string const & filename)
    return res;
 }
 
+// A xor constraint over k variables is encoded by the 2^(k-1) clauses over these variables, which
+// have the same parity of negative literals. Candidates are grouped by a hash of their variables.
+int Preprocessor::findXors(vec<Lit> & xors)
+{
+   vec<std::pair<uint64_t, CRef>> cands;
+   for (int i = 0; i < clauses.size(); ++i)
+   {
+      Clause const & c = ca[clauses[i]];
+      if (c.mark() != 0 || c.size() < 3 || c.size() > xorMaxSize)
+         continue;
+      uint64_t h = c.size();
+      for (int j = 0; j < c.size(); ++j)
+      {
+         uint64_t const x = (static_cast<uint64_t>(c[j].var()) + 1) * 0x9E3779B97F4A7C15ull;
+         h += x ^ (x >> 29);
+      }
+      cands.push(std::make_pair(h, clauses[i]));
+   }
+   sort(cands);
+
+   int nXors = 0;
+   vec<Var> vars, other;
+   vec<char> patterns;
+   for (int i = 0, end; i < cands.size(); i = end)
+   {
+      for (end = i + 1; end < cands.size() && cands[end].first == cands[i].first; ++end)
+         ;
+      Clause const & first = ca[cands[i].second];
+      int const k = first.size();
+      if (end - i < (1 << (k - 1)))
+         continue;
+      vars.clear();
+      for (int j = 0; j < k; ++j)
+         vars.push(first[j].var());
+      sort(vars);
+
+      // Marks the sign pattern of each clause over the sorted variables:
+      patterns.clear();
+      patterns.growTo(1 << k, 0);
+      int count[2] = { 0, 0 };
+      for (int j = i; j < end; ++j)
+      {
+         Clause const & c = ca[cands[j].second];
+         other.clear();
+         for (int l = 0; l < k; ++l)
+            other.push(c[l].var());
+         sort(other);
+         bool same = true;
+         for (int l = 0; l < k && same; ++l)
+            same = other[l] == vars[l];
+         if (!same)
+            continue;
+         int pattern = 0;
+         for (int l = 0; l < k; ++l)
+            if (c[l].sign())
+               for (int m = 0; m < k; ++m)
+                  if (vars[m] == c[l].var())
+                     pattern |= 1 << m;
+         if (!patterns[pattern])
+         {
+            patterns[pattern] = 1;
+            ++count[__builtin_popcount(pattern) & 1];
+         }
+      }
+
+      // The clauses forbid the assignments of one parity:
+      for (int p = 0; p < 2; ++p)
+         if (count[p] == (1 << (k - 1)))
+         {
+            xors.push(Lit(vars[0], p == 1));
+            for (int l = 1; l < k; ++l)
+               xors.push(Lit(vars[l], false));
+            xors.push(Lit::Undef());
+            ++nXors;
+         }
+   }
+   return nXors;
+}
+
 typename Preprocessor::Var Preprocessor::newVar()
 {
    Var v = ig.nVars();
@@ -201,6 +469,13 @@ typename Preprocessor::Var Preprocessor::newVar()
       n_occ.push(0);
       occurs.init(v);
       touched.push(0);
+      blockMarks.push(0);
+      blockMarks.push(0);
+      for (int i = 0; i < gateMarks.size(); ++i)
+      {
+         gateMarks[i].push(0);
+         gateMarks[i].push(0);
+      }
       elim_heap.insert(v);
    }
    return v;
@@ -216,6 +491,13 @@ bool Preprocessor::addClause(vec<Lit>& ps, bool const initial)
    if (!isOk())
       return false;
 
+   if (initial && keepOriginal)
+   {
+      for (int i = 0; i < ps.size(); ++i)
+         originalClauses.push(ps[i]);
+      originalClauses.push(Lit::Undef());
+   }
+
    if (initial && drat.isActive())
       ps.copyTo(add_oc);
 
@@ -503,35 +785,190 @@ bool Preprocessor::backwardSubsumptionCheck(bool verbose)
    return true;
 }
 
-bool Preprocessor::eliminateVar(Var const v)
+// Every clause is checked as subsumer against the clauses of its least occurring variable. The
+// candidate pairs are collected in parallel and applied sequentially in clause order.
+bool Preprocessor::subsumeParallel()
 {
+   assert(ig.decisionLevel() == 0);
+   occurs.cleanAll();
+
+   int const nChunks = (clauses.size() + subsumeChunkSize - 1) / subsumeChunkSize;
+   vec<vec<CRef>> candidates(nChunks);
+   workers.run(nChunks, [&](int const chunk, int)
+   {
+      vec<CRef> & pairs = candidates[chunk];
+      int const end = std::min(clauses.size(), (chunk + 1) * subsumeChunkSize);
+      for (int i = chunk * subsumeChunkSize; i < end; ++i)
+      {
+         CRef const cr = clauses[i];
+         Clause const & c = ca[cr];
+         if (c.mark() != 0)
+            continue;
+
+         Var best = c[0].var();
+         for (int j = 1; j < c.size(); j++)
+            if (occurs[c[j].var()].size() < occurs[best].size())
+               best = c[j].var();
+
+         vec<CRef> const & cs = occurs[best];
+         for (int j = 0; j < cs.size(); j++)
+         {
+            Clause const & other = ca[cs[j]];
+            if (cs[j] != cr && other.mark() == 0
+               && (subsumption_lim == -1 || other.size() < subsumption_lim)
+               && c.subsumes(other) != Lit::Error())
+            {
+               pairs.push(cr);
+               pairs.push(cs[j]);
+            }
+         }
+      }
+   });
+
+   // All clauses were checked, strengthened ones are queued again by strengthenClause():
+   subsumption_queue.clear();
+   for (int i = 0; i < touched.size(); ++i)
+      touched[i] = 0;
+   n_touched = 0;
+
+   int subsumed = 0, deleted_literals = 0;
+   for (int i = 0; i < nChunks; ++i)
+   {
+      vec<CRef> const & pairs = candidates[i];
+      for (int j = 0; j < pairs.size(); j += 2)
+      {
+         Clause const & c = ca[pairs[j]];
+         if (c.mark() != 0 || ca[pairs[j + 1]].mark() != 0)
+            continue;
+         // the clauses might have been strengthened in between:
+         Lit const l = c.subsumes(ca[pairs[j + 1]]);
+         if (l == Lit::Undef())
+            subsumed++, removeClause(pairs[j + 1]);
+         else if (l != Lit::Error())
+         {
+            deleted_literals++;
+            if (!strengthenClause(pairs[j + 1], ~l))
+               return setOk(false);
+         }
+      }
+      candidates[i].clear(true);
+   }
+   if (verb > 0)
+      printf("c subsumption: %d subsumed, %d deleted literals\n", subsumed, deleted_literals);
+   return true;
+}
+
+int Preprocessor::selectEliminationBatch()
+{
+   // The clauses of the batch variables are marked with 2 during the selection:
+   int nBatch = 0;
+   elimDeferred.clear();
+   while (!elim_heap.empty() && nBatch < elimBatchSize && elimDeferred.size() < elimBatchSize / 8)
+   {
+      Var const v = elim_heap.removeMin();
+      if (isEliminated(v) || !ig.value(v).isUndef())
+         continue;
+
+      vec<CRef> const & cls = occurs.lookup(v);
+      int i = 0;
+      while (i < cls.size() && ca[cls[i]].mark() == 0)
+         ++i;
+      if (i < cls.size())
+      {
+         elimDeferred.push(v);
+         continue;
+      }
+
+      for (i = 0; i < cls.size(); ++i)
+         ca[cls[i]].mark(2);
+      if (elimBatch.size() == nBatch)
+         elimBatch.push();
+      elimBatch[nBatch++].v = v;
+   }
+
+   for (int k = 0; k < nBatch; ++k)
+   {
+      vec<CRef> const & cls = occurs[elimBatch[k].v];
+      for (int i = 0; i < cls.size(); ++i)
+         ca[cls[i]].mark(0);
+   }
+   for (int i = 0; i < elimDeferred.size(); ++i)
+      if (!elim_heap.inHeap(elimDeferred[i]))
+         elim_heap.insert(elimDeferred[i]);
+
+   return nBatch;
+}
+
+// Only reads the clauses of e.v, so it may run concurrently for the variables of one batch.
+void Preprocessor::checkElimination(ElimCandidate & e, vec<char> & marks)
+{
+   Var const v = e.v;
    assert(!isEliminated(v));
    assert(ig.value(v).isUndef());
+   e.eliminate = false;
+   e.pos.clear();
+   e.neg.clear();
+   e.resolvents.clear();
 
 // Split the occurrences into positive and negative:
 //
-   const vec<CRef>& cls = occurs.lookup(v);
-   vec<CRef> pos, neg;
+   const vec<CRef>& cls = occurs[v];
+   vec<CRef> & pos = e.pos, & neg = e.neg;
    for (int i = 0; i < cls.size(); i++)
       (find(ca[cls[i]], Lit(v, false)) ? pos : neg).push(cls[i]);
 
 // Check wether the increase in number of clauses stays within the allowed ('grow'). Moreover, no
 // clause must exceed the limit on the maximal clause size (if it is set):
 //
+   // With a gate definition, only gate against non-gate clauses are resolved. The resolvents among
+   // the gate clauses are tautologies and the ones among the non-gate clauses are implied.
+   int nPosGates = 0, nNegGates = 0;
+   e.gate = gates ? findGate(v, pos, neg, nPosGates, nNegGates, marks) : GateType::None;
+   bool const gate = e.gate != GateType::None;
+
    int cnt = 0;
    int clause_size = 0;
 
    for (int i = 0; i < pos.size(); i++)
       for (int j = 0; j < neg.size(); j++)
-         if (merge(ca[pos[i]], ca[neg[j]], v, clause_size)
+         if ((!gate || (i < nPosGates) != (j < nNegGates))
+            && merge(ca[pos[i]], ca[neg[j]], v, clause_size)
             && (++cnt > cls.size() + grow || (clause_lim != -1 && clause_size > clause_lim)))
-            return true;
+            return;
+
+// Produce clauses in cross product:
+   vec<Lit> resolvent;
+   for (int i = 0; i < pos.size(); i++)
+      for (int j = 0; j < neg.size(); j++)
+         if ((!gate || (i < nPosGates) != (j < nNegGates))
+            && merge(ca[pos[i]], ca[neg[j]], v, resolvent))
+         {
+            for (int k = 0; k < resolvent.size(); ++k)
+               e.resolvents.push(resolvent[k]);
+            e.resolvents.push(Lit::Undef());
+         }
+   e.eliminate = true;
+}
+
+bool Preprocessor::eliminateVar(ElimCandidate const & e)
+{
+   Var const v = e.v;
+   if (!isOk())
+      return false;
+   // Units of the previous variables of the batch may have assigned it:
+   if (!e.eliminate || !ig.value(v).isUndef())
+      return true;
+   assert(!isEliminated(v));
 
 // Delete and store old clauses:
    eliminated[v] = true;
    branch.setDecisionVar(v, false);
    eliminated_vars++;
+   nAndGates += e.gate == GateType::And;
+   nIteGates += e.gate == GateType::Ite;
+   nXorGates += e.gate == GateType::Xor;
 
+   vec<CRef> const & pos = e.pos, & neg = e.neg;
    if (pos.size() > neg.size())
    {
       for (int i = 0; i < neg.size(); i++)
@@ -544,15 +981,21 @@ bool Preprocessor::eliminateVar(Var const v)
       elimDb.addElimUnit(Lit(v, true));
    }
 
-// Produce clauses in cross product:
+// Add the resolvents:
    vec<Lit>& resolvent = add_tmp;
-   for (int i = 0; i < pos.size(); i++)
-      for (int j = 0; j < neg.size(); j++)
-         if (merge(ca[pos[i]], ca[neg[j]], v, resolvent) && !addClause(resolvent))
-            return false;
+   resolvent.clear();
+   for (int i = 0; i < e.resolvents.size(); ++i)
+      if (e.resolvents[i] != Lit::Undef())
+         resolvent.push(e.resolvents[i]);
+      else if (!addClause(resolvent))
+         return false;
+      else
+         resolvent.clear();
 
-   for (int i = 0; i < cls.size(); i++)
-      removeClause(cls[i]);
+   for (int i = 0; i < pos.size(); i++)
+      removeClause(pos[i]);
+   for (int i = 0; i < neg.size(); i++)
+      removeClause(neg[i]);
 
 // Free occurs list for this variable:
    occurs[v].clear(true);
@@ -560,7 +1003,202 @@ bool Preprocessor::eliminateVar(Var const v)
 // Free watchers lists for this variable, if possible:
    propEngine.removeVar(v);
 
-   return backwardSubsumptionCheck();
+   return true;
+}
+
+typename Preprocessor::GateType Preprocessor::findGate(Var const v, vec<CRef> & pos, vec<CRef> & neg,
+                                                       int & nPosGates, int & nNegGates,
+                                                       vec<char> & marks)
+{
+   nPosGates = nNegGates = 0;
+   if (findAndGate(Lit(v, false), pos, neg, nPosGates, nNegGates, marks)
+      || findAndGate(Lit(v, true), neg, pos, nNegGates, nPosGates, marks))
+      return GateType::And;
+   else if (findIteGate(v, pos, neg, nPosGates, nNegGates))
+      return GateType::Ite;
+   else if (findXorGate(v, pos, neg, nPosGates, nNegGates))
+      return GateType::Xor;
+   return GateType::None;
+}
+
+// g = and(a_1, ..., a_n): the binaries (~g | a_i) and the clause (g | ~a_1 | ... | ~a_n)
+bool Preprocessor::findAndGate(Lit const g, vec<CRef> & gs, vec<CRef> & ngs, int & nGates, int & nNegGates,
+                               vec<char> & marks)
+{
+   for (int i = 0; i < ngs.size(); ++i)
+   {
+      Clause const & c = ca[ngs[i]];
+      if (c.size() == 2)
+         marks[(c[0] == ~g ? c[1] : c[0]).toInt()] = 1;
+   }
+
+   int found = -1;
+   for (int i = 0; i < gs.size() && found < 0; ++i)
+   {
+      Clause const & c = ca[gs[i]];
+      int j = 0;
+      while (j < c.size() && (c[j] == g || marks[(~c[j]).toInt()]))
+         ++j;
+      if (j == c.size())
+         found = i;
+   }
+
+   if (found >= 0)
+   {
+      std::swap(gs[0], gs[found]);
+      nGates = 1;
+      Clause const & base = ca[gs[0]];
+      for (int j = 0; j < base.size(); ++j)
+         marks[(~base[j]).toInt()] = 2;
+      nNegGates = 0;
+      for (int i = 0; i < ngs.size(); ++i)
+      {
+         Clause const & c = ca[ngs[i]];
+         if (c.size() == 2)
+         {
+            Lit const a = c[0] == ~g ? c[1] : c[0];
+            if (marks[a.toInt()] == 2)
+            {
+               marks[a.toInt()] = 1;  // take only one of duplicate binaries
+               std::swap(ngs[nNegGates++], ngs[i]);
+            }
+         }
+      }
+      for (int j = 0; j < base.size(); ++j)
+         marks[(~base[j]).toInt()] = 0;
+   }
+
+   for (int i = 0; i < ngs.size(); ++i)
+   {
+      Clause const & c = ca[ngs[i]];
+      if (c.size() == 2)
+         marks[(c[0] == ~g ? c[1] : c[0]).toInt()] = 0;
+   }
+   return found >= 0;
+}
+
+// returns the index of the ternary clause (a | b | c) in cs or -1
+int Preprocessor::findTernary(vec<CRef> const & cs, Lit const a, Lit const b, Lit const c) const
+{
+   for (int i = 0; i < cs.size(); ++i)
+   {
+      Clause const & d = ca[cs[i]];
+      if (d.size() == 3 && find(d, a) && find(d, b) && find(d, c))
+         return i;
+   }
+   return -1;
+}
+
+// v = ite(c, t, e): (v | x | y), (v | ~x | z), (~v | x | ~y) and (~v | ~x | ~z) with x = ~c,
+// y = ~t and z = ~e. The pattern is symmetric in the polarity of v.
+bool Preprocessor::findIteGate(Var const v, vec<CRef> & pos, vec<CRef> & neg, int & nPosGates, int & nNegGates)
+{
+   Lit const p = Lit(v, false);
+   for (int i = 0; i < pos.size(); ++i)
+   {
+      Clause const & c1 = ca[pos[i]];
+      if (c1.size() != 3)
+         continue;
+      for (int j = i + 1; j < pos.size(); ++j)
+      {
+         Clause const & c2 = ca[pos[j]];
+         if (c2.size() != 3)
+            continue;
+         for (int k = 0; k < 3; ++k)
+         {
+            Lit const x = c1[k];
+            if (x == p || !find(c2, ~x))
+               continue;
+            Lit const y = c1[(k + 1) % 3] == p ? c1[(k + 2) % 3] : c1[(k + 1) % 3];
+            Lit z = Lit::Undef();
+            for (int m = 0; m < 3; ++m)
+               if (c2[m] != p && c2[m] != ~x)
+                  z = c2[m];
+            if (y.var() == x.var() || z == Lit::Undef() || z.var() == x.var())
+               continue;
+            int const n1 = findTernary(neg, ~p, x, ~y);
+            int const n2 = findTernary(neg, ~p, ~x, ~z);
+            if (n1 < 0 || n2 < 0)
+               continue;
+            std::swap(pos[0], pos[i]);
+            std::swap(pos[1], pos[j]);
+            std::swap(neg[0], neg[n1]);
+            std::swap(neg[1], neg[n2 == 0 ? n1 : n2]);
+            nPosGates = nNegGates = 2;
+            return true;
+         }
+      }
+   }
+   return false;
+}
+
+// v = xor(a_1, ..., a_n): all 2^n clauses over v, a_1, ..., a_n with the parity of the first one
+bool Preprocessor::findXorGate(Var const v, vec<CRef> & pos, vec<CRef> & neg, int & nPosGates, int & nNegGates)
+{
+   for (int i = 0; i < pos.size(); ++i)
+   {
+      Clause const & base = ca[pos[i]];
+      int const size = base.size();
+      if (size < 3 || size > gateXorLimit + 1 || pos.size() + neg.size() < (1 << (size - 1)))
+         continue;
+
+      // the bit j of a pattern is set, if the literal of the variable of base[j] is negated
+      auto pattern = [&](Clause const & c)
+      {
+         unsigned res = 0;
+         for (int j = 0; j < size; ++j)
+         {
+            int k = 0;
+            while (k < size && c[k].var() != base[j].var())
+               ++k;
+            if (k == size)
+               return -1;
+            res |= unsigned(c[k].sign()) << j;
+         }
+         return int(res);
+      };
+      int const parity = __builtin_parity(pattern(base));
+
+      vec<char> seen(1 << size, 0);
+      int nFound = 0;
+      for (int side = 0; side < 2; ++side)
+      {
+         vec<CRef> const & cs = side == 0 ? pos : neg;
+         for (int j = 0; j < cs.size(); ++j)
+         {
+            Clause const & c = ca[cs[j]];
+            if (c.size() != size)
+               continue;
+            int const pat = pattern(c);
+            if (pat >= 0 && __builtin_parity(pat) == parity && !seen[pat])
+            {
+               seen[pat] = 1;
+               ++nFound;
+            }
+         }
+      }
+      if (nFound < (1 << (size - 1)))
+         continue;
+
+      nPosGates = nNegGates = 0;
+      for (int side = 0; side < 2; ++side)
+      {
+         vec<CRef> & cs = side == 0 ? pos : neg;
+         int & nGates = side == 0 ? nPosGates : nNegGates;
+         for (int j = 0; j < cs.size(); ++j)
+         {
+            Clause const & c = ca[cs[j]];
+            int const pat = (c.size() == size) ? pattern(c) : -1;
+            if (pat >= 0 && seen[pat])
+            {
+               seen[pat] = 0;
+               std::swap(cs[nGates++], cs[j]);
+            }
+         }
+      }
+      return true;
+   }
+   return false;
 }
 
 bool Preprocessor::substitute(Var v, Lit x)
@@ -596,6 +1234,97 @@ bool Preprocessor::substitute(Var v, Lit x)
    return true;
 }
 
+bool Preprocessor::substituteEquivalences()
+{
+   if (!removeRedundant())
+      return false;
+
+   EquivalentLiterals<MinisatPropagate<ClauseAllocator>> equivalences(ig, propEngine);
+   if (!equivalences.run([&](Var const v)
+   {  return !isEliminated(v);}))
+   {
+      Lit const l = equivalences.contradiction();
+      add_tmp.clear();
+      add_tmp.push(~l);
+      drat.addClause(add_tmp);
+      drat.addEmptyClause();
+      drat.flush();
+      return setOk(false);
+   }
+   if (equivalences.nSubstituted() == 0)
+      return true;
+
+   // the equivalences make every substituted clause derivable by unit propagation
+   vec<Var> substituted;
+   for (Var v = 0; v < ig.nVars(); ++v)
+      if (equivalences.representative(Lit(v, false)).var() != v)
+      {
+         Lit const r = equivalences.representative(Lit(v, false));
+         substituted.push(v);
+         add_tmp.clear();
+         add_tmp.push(Lit(v, true));
+         add_tmp.push(r);
+         drat.addClause(add_tmp);
+         add_tmp[0] = Lit(v, false);
+         add_tmp[1] = ~r;
+         drat.addClause(add_tmp);
+
+         eliminated[v] = true;
+         branch.setDecisionVar(v, false);
+         elimDb.addElimEquivalence(v, r);
+         ++eliminated_vars;
+      }
+
+   int const nInitial = clauses.size();
+   for (int i = 0; i < nInitial && isOk(); ++i)
+   {
+      CRef const cr = clauses[i];
+      if (ca[cr].mark() != 0)
+         continue;
+      Clause const & c = ca[cr];
+      int k = 0;
+      while (k < c.size() && equivalences.representative(c[k]) == c[k])
+         ++k;
+      if (k == c.size())
+         continue;
+
+      add_tmp.clear();
+      for (k = 0; k < c.size(); ++k)
+         add_tmp.push(equivalences.representative(c[k]));
+      if (!addClause(add_tmp))
+         break;
+      drat.removeClause(ca[cr]);
+      removeClause(cr);
+   }
+   int i = 0, j = 0;
+   for (; i < clauses.size(); ++i)
+      if (ca[clauses[i]].mark() != 1)
+         clauses[j++] = clauses[i];
+   clauses.shrink(i - j);
+
+   for (i = 0; i < substituted.size(); ++i)
+   {
+      Var const v = substituted[i];
+      Lit const r = equivalences.representative(Lit(v, false));
+      add_tmp.clear();
+      add_tmp.push(Lit(v, true));
+      add_tmp.push(r);
+      drat.removeClause(add_tmp);
+      add_tmp[0] = Lit(v, false);
+      add_tmp[1] = ~r;
+      drat.removeClause(add_tmp);
+   }
+   if (verb > 0)
+      printf("c substituted %d equivalent variables\n", substituted.size());
+
+   if (!isOk())
+   {
+      drat.addEmptyClause();
+      drat.flush();
+   }
+   return isOk();
+}
+
 int Preprocessor::nFreeVars() const
 {
    return (int) branch.nDecVars() - (ig.decisionLevel() == 0 ? ig.nAssigns() : ig.levelEnd(0));
@@ -631,7 +1360,9 @@ bool Preprocessor::removeRedundant(bool const removeFalseLits)
       for (; i < clauses.size(); ++i)
       {
          Clause const & c = ca[clauses[i]];
-         if (c.mark() == 0 && !ig.satisfied(c))
+         if (c.mark() != 0)
+            continue;
+         else if (!ig.satisfied(c))
             clauses[j++] = clauses[i];
          else
             removeClause(clauses[i]);
@@ -723,6 +1454,191 @@ bool Preprocessor::eliminateMinimalNiver()
    return true;
 }
 
+// Returns true, if all resolvents on l of the clause marked in blockMarks are tautologies.
+bool Preprocessor::isBlocked(Lit const l, int64_t & steps) const
+{
+   vec<CRef> const & cls = occurs[l.var()];
+   for (int i = 0; i < cls.size(); ++i)
+   {
+      Clause const & d = ca[cls[i]];
+      if (d.mark() != 0)
+         continue;
+      steps -= d.size();
+      bool partner = false, tautology = false;
+      for (int j = 0; j < d.size() && !tautology; ++j)
+         if (d[j] == ~l)
+            partner = true;
+         else
+            tautology = blockMarks[(~d[j]).toInt()] & 1;
+      if (partner && !tautology)
+         return false;
+   }
+   return true;
+}
+
+// Adds covered literals to the clause until it becomes blocked or a tautology. The extension
+// steps are stored for the model reconstruction, each with the literal it was based on.
+bool Preprocessor::eliminateCovered(CRef const cr, int64_t & steps)
+{
+   Clause const & c = ca[cr];
+   vec<Lit> & ext = coverLits;
+   ext.clear();
+   coverWitnesses.clear();
+   coverPrefix.clear();
+   for (int i = 0; i < c.size(); ++i)
+   {
+      ext.push(c[i]);
+      blockMarks[c[i].toInt()] |= 1;
+   }
+
+   bool tautology = false;
+   Lit blocking = Lit::Undef();
+   for (int i = 0; i < ext.size() && !tautology && blocking == Lit::Undef() && steps > 0; ++i)
+   {
+      // The literals common to all non tautological resolution partners on l are covered:
+      Lit const l = ext[i];
+      if (!ig.value(l).isUndef())
+         continue;
+      bool first = true;
+      coverCommon.clear();
+      vec<CRef> const & cls = occurs[l.var()];
+      for (int j = 0; j < cls.size() && (first || coverCommon.size() > 0); ++j)
+      {
+         Clause const & d = ca[cls[j]];
+         if (d.mark() != 0)
+            continue;
+         steps -= d.size();
+         bool partner = false, taut = false;
+         for (int k = 0; k < d.size() && !taut; ++k)
+            if (d[k] == ~l)
+               partner = true;
+            else
+               taut = blockMarks[(~d[k]).toInt()] & 1;
+         if (!partner || taut)
+            continue;
+
+         if (first)
+         {
+            for (int k = 0; k < d.size(); ++k)
+               if (d[k] != ~l && !(blockMarks[d[k].toInt()] & 1))
+                  coverCommon.push(d[k]);
+            first = false;
+         } else
+         {
+            for (int k = 0; k < d.size(); ++k)
+               blockMarks[d[k].toInt()] |= 2;
+            int n = 0;
+            for (int k = 0; k < coverCommon.size(); ++k)
+               if (blockMarks[coverCommon[k].toInt()] & 2)
+                  coverCommon[n++] = coverCommon[k];
+            coverCommon.shrink(coverCommon.size() - n);
+            for (int k = 0; k < d.size(); ++k)
+               blockMarks[d[k].toInt()] &= ~2;
+         }
+      }
+
+      if (first)
+         blocking = l;
+      else if (coverCommon.size() > 0)
+      {
+         coverWitnesses.push(l);
+         coverPrefix.push(ext.size());
+         for (int k = 0; k < coverCommon.size(); ++k)
+         {
+            Lit const m = coverCommon[k];
+            tautology |= blockMarks[(~m).toInt()] & 1;
+            blockMarks[m.toInt()] |= 1;
+            ext.push(m);
+         }
+      }
+   }
+
+   for (int i = 0; i < ext.size(); ++i)
+      blockMarks[ext[i].toInt()] = 0;
+   if (!tautology && blocking == Lit::Undef())
+      return false;
+
+   // Reconstruction runs backwards: first the blocked extension, then the steps in reverse order.
+   vec<Lit> & step = coverCommon;
+   for (int k = 0; k < coverWitnesses.size(); ++k)
+   {
+      step.clear();
+      for (int i = 0; i < coverPrefix[k]; ++i)
+         step.push(ext[i]);
+      elimDb.addElimClause(coverWitnesses[k].var(), step);
+   }
+   if (blocking != Lit::Undef())
+   {
+      if (coverWitnesses.size() > 0)
+         elimDb.addElimClause(blocking.var(), ext);
+      else
+         elimDb.addElimClause(blocking.var(), c);
+   }
+   return true;
+}
+
+bool Preprocessor::eliminateBlocked()
+{
+   if (!removeRedundant())
+      return setOk(false);
+
+   int64_t steps = blockedElimSteps;
+   vec<Lit> queue;
+   vec<char> queued(2 * nVars(), 1);
+   for (Var v = 0; v < nVars(); ++v)
+   {
+      queue.push(Lit(v, false));
+      queue.push(Lit(v, true));
+   }
+
+   // A clause is blocked on l, if all its resolvents on l are tautologies. Removing it may block
+   // clauses containing the negation of one of its other literals.
+   for (int qi = 0; qi < queue.size() && steps > 0; ++qi)
+   {
+      Lit const l = queue[qi];
+      queued[l.toInt()] = 0;
+      if (isEliminated(l.var()) || !ig.value(l).isUndef())
+         continue;
+
+      vec<CRef> const & cls = occurs[l.var()];
+      for (int i = 0; i < cls.size() && steps > 0; ++i)
+      {
+         CRef const cr = cls[i];
+         Clause const & c = ca[cr];
+         if (c.mark() != 0 || !find(c, l))
+            continue;
+
+         steps -= c.size();
+         for (int j = 0; j < c.size(); ++j)
+            blockMarks[c[j].toInt()] = 1;
+         bool const blocked = isBlocked(l, steps);
+         for (int j = 0; j < c.size(); ++j)
+            blockMarks[c[j].toInt()] = 0;
+         if (!blocked)
+            continue;
+
+         ++nBlockedClauses;
+         elimDb.addElimClause(l.var(), c);
+         for (int j = 0; j < c.size(); ++j)
+            if (c[j] != l && !queued[(~c[j]).toInt()])
+            {
+               queued[(~c[j]).toInt()] = 1;
+               queue.push(~c[j]);
+            }
+         removeClause(cr);
+      }
+   }
+
+   if (coveredElim)
+      for (int i = 0; i < clauses.size() && steps > 0; ++i)
+         if (ca[clauses[i]].mark() == 0 && eliminateCovered(clauses[i], steps))
+         {
+            ++nCoveredClauses;
+            removeClause(clauses[i]);
+         }
+   return true;
+}
+
 // The technique and code are by the courtesy of the GlueMiniSat team. Thank you!
 // It helps solving certain types of huge problems tremendously.
 
@@ -744,6 +1660,8 @@ bool Preprocessor::eliminate()
       eliminateMinimalNiver();
       goto cleanup;
    }
+   if (!subsumeParallel() || (blockedElim && !eliminateBlocked()))
+      goto cleanup;
    eliminate_();  // The first, usual variable elimination of MiniSat.
    if (!isOk())
       goto cleanup;
@@ -790,6 +1708,10 @@ bool Preprocessor::eliminate()
 
    cleanup:
 
+   if (verb > 0 && gates)
+      printf("c gates: %d and, %d ite, %d xor\n", nAndGates, nIteGates, nXorGates);
+   if (verb > 0 && blockedElim)
+      printf("c removed clauses: %d blocked, %d covered\n", nBlockedClauses, nCoveredClauses);
    if (!isOk())
    {
       drat.addEmptyClause();
@@ -845,21 +1767,29 @@ bool Preprocessor::eliminate_()
       }
 
 // printf("  ## (time = %6.2f s) ELIM: vars = %d\n", cpuTime(), elim_heap.size());
-      for (int cnt = 0; !elim_heap.empty(); cnt++)
+      while (!elim_heap.empty())
       {
-         Var elim = elim_heap.removeMin();
-
          if (hasInterrupt())
             break;
 
-         if (isEliminated(elim) || !ig.value(elim).isUndef())
-            continue;
-
-         if (verb >= 2 && cnt % 100 == 0)
+         if (verb >= 2)
             printf("c elimination left: %10d\r", elim_heap.size());
-         // At this point, the variable may have been set by assymetric branching, so check it
-         // again. Also, don't eliminate frozen variables:
-         if (ig.value(elim).isUndef() && !eliminateVar(elim))
+
+         // The variables of a batch do not share clauses, so the elimination of one does not change
+         // the clauses of the others. Their checks and resolvents are computed in parallel, the
+         // eliminations are applied sequentially in batch order:
+         int const nBatch = selectEliminationBatch();
+         workers.run(nBatch, [&](int const i, int const thread)
+         {
+            checkElimination(elimBatch[i], gateMarks[thread]);
+         });
+         for (int i = 0; i < nBatch; ++i)
+            if (!eliminateVar(elimBatch[i]))
+            {
+               setOk(false);
+               goto cleanup;
+            }
+         if (!backwardSubsumptionCheck())
          {
             setOk(false);
             goto cleanup;
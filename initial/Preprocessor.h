@@ -44,14 +44,16 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "core/Statistic.h"
 #include "branch/Branch.h"
 #include "propagate/MiniSatPropagate.h"
+#include "minimize/EquivalentLiterals.h"
 #include "initial/SatInstance.h"
 #include "initial/SolverConfig.h"
 #include "utils/DratPrint.h"
+#include "utils/ParallelFor.h"
 #include "utils/Random.h"
 
 #include "utils/Exceptions.h"
+#include "utils/MappedFile.h"
 #include "utils/ParseUtils.h"
-#include <zlib.h>
 
 #include "EliminatedClauseDatabase.h"
 
@@ -110,6 +112,26 @@ class Preprocessor
       }
    };
 
+   enum class GateType
+   {
+      None,
+      And,
+      Ite,
+      Xor
+   };
+
+   // A variable of an elimination batch together with the result of the elimination check. The
+   // check of the variables of one batch is done in parallel, the elimination itself sequentially.
+   struct ElimCandidate
+   {
+      Var v;
+      bool eliminate;
+      GateType gate;
+      vec<CRef> pos;
+      vec<CRef> neg;
+      vec<Lit> resolvents;  // separated by Lit::Undef()
+   };
+
    struct ClauseDeleted
    {
       const ClauseAllocator& ca;
@@ -124,6 +146,12 @@ class Preprocessor
    };
 
    bool elim;          // Perform variable elimination.
+   bool equiv;         // Substitute equivalent literals.
+   bool gates;         // Use gate definitions during variable elimination.
+   bool blockedElim;   // Remove blocked clauses before variable elimination.
+   bool coveredElim;   // Remove covered clauses before variable elimination.
+   bool gauss;         // Collect the xor constraints of the clauses for Gauss-Jordan elimination.
+   bool keepOriginal;  // Keep the clauses of the input in originalClauses.
    bool ok;
 
    int verb;
@@ -134,6 +162,14 @@ class Preprocessor
    int bwdsub_assigns;
    int n_touched;
    int eliminated_vars;
+   int gateXorLimit;  // Maximal number of inputs of xor gates.
+   int nAndGates;
+   int nIteGates;
+   int nXorGates;
+   int blockedElimSteps;  // Maximal number of literal visits of blocked clause elimination.
+   int nBlockedClauses;
+   int nCoveredClauses;
+   int xorMaxSize;  // Maximal size of the collected xor constraints.
    CRef bwdsub_tmpunit;
    double simp_garbage_frac;  // A different limit for when to issue a GC during simplification (Also see 'garbage_frac').
 
@@ -148,7 +184,17 @@ class Preprocessor
    Heap<ElimLt> elim_heap;
    Queue<CRef> subsumption_queue;
    vec<char> eliminated;
+   vec<vec<char>> gateMarks;  // per thread and literal
+   vec<ElimCandidate> elimBatch;
+   vec<Var> elimDeferred;
+   vec<char> blockMarks;  // per literal
+   vec<Lit> coverLits;
+   vec<Lit> coverCommon;
+   vec<Lit> coverWitnesses;
+   vec<int> coverPrefix;
+   ParallelFor workers;  // Used for parsing, subsumption and variable elimination.
    vec<Lit> add_tmp;
+   vec<Lit> originalClauses;  // each terminated by Lit::Undef()
 
 
    Statistic stat; // currently only for branch interface
@@ -167,6 +213,13 @@ class Preprocessor
 
    bool readInstance(std::string const & filename);
    bool readInstance_main(StreamBuffer & in);
+   bool readInstance_parallel(DecompressReader & in);
+   bool readInstance_mapped(MappedFile & file);
+   // Splits the input at line begins and parses the chunks in parallel into lits.
+   void readInstance_chunks(char const * data, size_t const size, vec<vec<int>> & lits,
+                            int & nHeaderVars, int & nHeaderClauses);
+   // Adds the parsed clauses of the chunks in order.
+   bool readInstance_merge(vec<vec<int>> & lits, int const nHeaderVars, int const nHeaderClauses);
    void readInstance_clause(StreamBuffer & in,vec<Lit> & lits);
 
    bool isEliminated(Var v) const;
@@ -182,6 +235,10 @@ class Preprocessor
 
    bool eliminateMinimalNiver();
 
+   bool eliminateBlocked();  // Blocked (and covered) clause elimination.
+   bool isBlocked(Lit const l, int64_t & steps) const;
+   bool eliminateCovered(CRef const cr, int64_t & steps);
+
    int nVars() const
    {
       return ig.nVars();
@@ -211,17 +268,38 @@ class Preprocessor
    bool addEmptyClause();                // Add the empty clause to the solver.
    bool addClause(vec<Lit>& ps, bool const initial = false);
    bool substitute(Var v, Lit x);  // Replace all occurences of v with x (may cause a contradiction).
+   bool substituteEquivalences();  // Replace the equivalent literals of the binary implication graph.
 
    void updateElimHeap(Var v);
    void gatherTouchedClauses();
    bool merge(const Clause& _ps, const Clause& _qs, Var v, vec<Lit>& out_clause);
    bool merge(const Clause& _ps, const Clause& _qs, Var v, int& size);
    bool backwardSubsumptionCheck(bool verbose = false);
-   bool eliminateVar(Var const v);
+   bool subsumeParallel();  // One round of subsumption over all clauses using all threads.
+
+   // Pops variables from elim_heap, which do not occur in a clause together, into elimBatch.
+   // Returns the batch size.
+   int selectEliminationBatch();
+   void checkElimination(ElimCandidate & e, vec<char> & marks);
+   bool eliminateVar(ElimCandidate const & e);
+
+   // Moves the clauses defining v as a gate output to the front of pos and neg and returns their
+   // number in nPosGates and nNegGates.
+   GateType findGate(Var const v, vec<CRef> & pos, vec<CRef> & neg, int & nPosGates, int & nNegGates,
+                     vec<char> & marks);
+   bool findAndGate(Lit const g, vec<CRef> & gs, vec<CRef> & ngs, int & nGates, int & nNegGates,
+                    vec<char> & marks);
+   bool findIteGate(Var const v, vec<CRef> & pos, vec<CRef> & neg, int & nPosGates, int & nNegGates);
+   bool findXorGate(Var const v, vec<CRef> & pos, vec<CRef> & neg, int & nPosGates, int & nNegGates);
+   int findTernary(vec<CRef> const & cs, Lit const a, Lit const b, Lit const c) const;
    bool eliminateVarMinimal(Var const v);
 
    bool removeRedundant(bool const removeFalseLits = false);
 
+   // Adds the xor constraints encoded by the clauses to xors, each terminated by Lit::Undef().
+   // Returns their number.
+   int findXors(vec<Lit> & xors);
+
    void removeClause(CRef const cr);
    bool strengthenClause(CRef cr, Lit l);
    void relocAll(ClauseAllocator& to, bool const finalGarbage = false);
@@ -100,6 +100,8 @@ SatInstance& SatInstance::operator =(SatInstance&& in)
    ca = std::move(in.ca);
    elimDb = std::move(in.elimDb);
    drat = std::move(in.drat);
+   xors = std::move(in.xors);
+   originalClauses = std::move(in.originalClauses);
    return *this;
 }
 
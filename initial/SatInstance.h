@@ -88,6 +88,8 @@ class SatInstance
    Database ca;
    EliminatedClauseDatabase elimDb;
    DratPrint<Lit> drat;
+   vec<Lit> xors;  // xor constraints implied by the clauses, each terminated by Lit::Undef()
+   vec<Lit> originalClauses;  // clauses of the input for verifying models, each terminated by Lit::Undef()
 
 };
 }
@@ -293,6 +293,11 @@ class SolverConfig
    // Minimization
    bool eliminate;
    bool useVivification;
+   double viviLocalEffort;
+   bool useProbing;
+   double probeEffort;
+   bool useLearntSubsumption;
+   double learntSubEffort;
    bool remove_satisfied;
    int ccmin_mode;
    int maxEntendedBinaryResolutionSz;
@@ -304,16 +309,31 @@ class SolverConfig
 
    // Preprocessor
    bool elim;
+   int preproThreads;
    int grow;
    int clause_lim;
    int subsumption_lim;
    double simp_garbage_frac;
+   bool useEquivalences;
+   bool useGates;
+   int gateXorLimit;
+   bool useBlockedElim;
+   bool useCoveredElim;
+   int blockedElimSteps;
+   bool useGauss;
+   int xorMaxSize;
+   bool keepOriginalClauses;  // Keep the input clauses for the verification of the model.
+   bool useInproElim;
+   int inproElimSteps;
+   int inproElimInterval;
 
    // Divers configs
    double garbage_frac;
    double rnd_seed;
 
    std::string drat_file;
+   bool dratBinary;
+   std::string cacheDir;
    int verbosity;
    int secToSwitchHeuristic;
 
@@ -329,6 +349,7 @@ class SolverConfig
    int max_import_lbd;
    int max_export_sz;
    int numConflictsToDelete;
+   double exportUsefulRate;
 
    static SolverConfig getInputConfig()
    {
@@ -480,6 +501,11 @@ class SolverConfig
 
            eliminate(true),
            useVivification(Inputs::useVivification),
+           viviLocalEffort(Inputs::viviLocalEffort),
+           useProbing(Inputs::useProbing),
+           probeEffort(Inputs::probeEffort),
+           useLearntSubsumption(Inputs::useLearntSubsumption),
+           learntSubEffort(Inputs::learntSubEffort),
            remove_satisfied(Inputs::remove_satisfied),
            ccmin_mode(Inputs::ccmin_mode),
            maxEntendedBinaryResolutionSz(Inputs::maxEntendedBinaryResolutionSz),
@@ -490,14 +516,29 @@ class SolverConfig
            nbconfbeforesimplify(1000),
 
            elim(Inputs::use_elim),
+           preproThreads(1),
            grow(Inputs::grow),
            clause_lim(Inputs::clause_lim),
            subsumption_lim(Inputs::subsumption_lim),
            simp_garbage_frac(Inputs::simp_garbage_frac),
+           useEquivalences(Inputs::equivalences),
+           useGates(Inputs::gates),
+           gateXorLimit(Inputs::gateXorLimit),
+           useBlockedElim(Inputs::blockedElim),
+           useCoveredElim(Inputs::coveredElim),
+           blockedElimSteps(Inputs::blockedElimSteps),
+           useGauss(Inputs::gauss),
+           xorMaxSize(Inputs::xorMaxSize),
+           keepOriginalClauses(Inputs::verifySat),
+           useInproElim(Inputs::inproElim),
+           inproElimSteps(Inputs::inproElimSteps),
+           inproElimInterval(Inputs::inproElimInterval),
 
            garbage_frac(Inputs::garbage_frac),
            rnd_seed(Inputs::random_seed),
            drat_file(static_cast<std::string>(Inputs::drat_file)),
+           dratBinary(Inputs::dratBinary),
+           cacheDir(static_cast<std::string>(Inputs::cacheDir)),
            verbosity(Inputs::verb),
            secToSwitchHeuristic(Inputs::secToSwitchHeuristic),
            conflict_budget(Inputs::conflict_budget),
@@ -509,7 +550,8 @@ class SolverConfig
            max_export_lbd(Inputs::max_export_lbd),
            max_import_lbd(Inputs::max_import_lbd),
            max_export_sz(Inputs::max_export_sz),
-           numConflictsToDelete(Inputs::numConflictsToDelete)
+           numConflictsToDelete(Inputs::numConflictsToDelete),
+           exportUsefulRate(Inputs::exportUsefulRate)
    {
    }
 };
@@ -0,0 +1,386 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef MINIMIZE_ELIMINATION_H_
+#define MINIMIZE_ELIMINATION_H_
+
+#include "initial/SolverConfig.h"
+#include "initial/EliminatedClauseDatabase.h"
+#include "core/ImplicationGraph.h"
+#include "core/Statistic.h"
+#include "mtl/Sort.h"
+#include "mtl/Alg.h"
+
+namespace ctsat
+{
+
+/**
+ * Bounded variable elimination at decision level 0 during search. Only variables occurring in
+ * clauses, which were removed or shortened since the last round, are candidates. The occurrence
+ * lists hold original and learnt clauses, but only original clauses are resolved. Learnt clauses
+ * of an eliminated variable are removed together with its original clauses.
+ */
+template <typename Propagate>
+class Elimination
+{
+   typedef typename Propagate::Database Database;
+   typedef typename Database::Lit Lit;
+   typedef typename Database::Var Var;
+   typedef typename Database::Clause Clause;
+   typedef typename Database::CRef CRef;
+   typedef typename Database::lbool lbool;
+
+ public:
+   Elimination(
+               SolverConfig const & config,
+               Statistic & stat,
+               Database & ca,
+               ImplicationGraph<Database> & ig);
+
+   void newVar();
+
+   // marks all variables of c as candidates for the next round
+   void touch(Clause const & c);
+   bool hasTouched() const;
+   bool isEliminated(Var const v) const;
+   void freeze(Var const v);  // v is never eliminated
+
+   void clearOccurrences();
+   void addOccurrences(CRef const cr);
+
+   // Eliminates touched variables until the step limit is reached. 'add' is called with each
+   // resolvent and a reference, which has to be set to the allocated clause (or npos). 'remove'
+   // is called for each clause of an eliminated variable. Returns false, if unsat was detected.
+   template <typename Branch, typename AddFunctor, typename RemoveFunctor>
+   bool run(
+            EliminatedClauseDatabase & elimDb,
+            Branch & branch,
+            AddFunctor const & add,
+            RemoveFunctor const & remove);
+
+ private:
+   struct ElimLt
+   {
+      vec<int> const & n_occ;
+      explicit ElimLt(vec<int> const & no)
+            : n_occ(no)
+      {
+      }
+      uint64_t cost(Var const x) const
+      {
+         return (uint64_t) n_occ[Lit(x, false).toInt()] * (uint64_t) n_occ[Lit(x, true).toInt()];
+      }
+      bool operator()(Var const x, Var const y) const
+      {
+         return cost(x) < cost(y);
+      }
+   };
+
+   Statistic & stat;
+   Database & ca;
+   ImplicationGraph<Database> & ig;
+
+   int const grow;
+   int const clause_lim;
+   uint64_t const maxSteps;
+   uint64_t steps;
+   int nTouched;
+
+   vec<char> touched;
+   vec<char> eliminated;
+   vec<char> frozen;
+   vec<vec<CRef>> occs;
+   vec<int> n_occ;
+   vec<Var> candidates;
+   vec<CRef> pos;
+   vec<CRef> neg;
+   vec<Lit> resolvent;
+
+   // Returns false if the resolvent is a tautology or satisfied at level 0. False literals are skipped.
+   bool merge(Clause const & _ps, Clause const & _qs, Var const v, vec<Lit> & out_clause);
+
+   template <typename Branch, typename AddFunctor, typename RemoveFunctor>
+   bool eliminateVar(
+                     Var const v,
+                     EliminatedClauseDatabase & elimDb,
+                     Branch & branch,
+                     AddFunctor const & add,
+                     RemoveFunctor const & remove);
+};
+
+template <typename Propagate>
+inline Elimination<Propagate>::Elimination(
+                                           SolverConfig const & config,
+                                           Statistic & stat,
+                                           Database & ca,
+                                           ImplicationGraph<Database> & ig)
+      : stat(stat),
+        ca(ca),
+        ig(ig),
+        grow(config.grow),
+        clause_lim(config.clause_lim),
+        maxSteps(config.inproElimSteps),
+        steps(0),
+        nTouched(0)
+{
+}
+
+template <typename Propagate>
+inline void Elimination<Propagate>::newVar()
+{
+   // the preprocessor might not have eliminated every variable, so all are candidates at first
+   touched.push(1);
+   eliminated.push(0);
+   frozen.push(0);
+   occs.push();
+   n_occ.push(0);
+   n_occ.push(0);
+   ++nTouched;
+}
+
+template <typename Propagate>
+inline void Elimination<Propagate>::touch(Clause const & c)
+{
+   for (int i = 0; i < c.size(); ++i)
+   {
+      Var const v = c[i].var();
+      nTouched += !touched[v];
+      touched[v] = 1;
+   }
+}
+
+template <typename Propagate>
+inline bool Elimination<Propagate>::hasTouched() const
+{
+   return nTouched > 0;
+}
+
+template <typename Propagate>
+inline bool Elimination<Propagate>::isEliminated(Var const v) const
+{
+   return eliminated[v];
+}
+
+template <typename Propagate>
+inline void Elimination<Propagate>::freeze(Var const v)
+{
+   frozen[v] = 1;
+}
+
+template <typename Propagate>
+inline void Elimination<Propagate>::clearOccurrences()
+{
+   for (int i = 0; i < occs.size(); ++i)
+      occs[i].clear();
+   for (int i = 0; i < n_occ.size(); ++i)
+      n_occ[i] = 0;
+}
+
+template <typename Propagate>
+inline void Elimination<Propagate>::addOccurrences(CRef const cr)
+{
+   Clause const & c = ca[cr];
+   bool const original = c.getLearnt() == 0;
+   for (int i = 0; i < c.size(); ++i)
+   {
+      occs[c[i].var()].push(cr);
+      n_occ[c[i].toInt()] += original;
+   }
+}
+
+template <typename Propagate>
+inline bool Elimination<Propagate>::merge(
+                                          Clause const & _ps,
+                                          Clause const & _qs,
+                                          Var const v,
+                                          vec<Lit> & out_clause)
+{
+   out_clause.clear();
+
+   bool const ps_smallest = _ps.size() < _qs.size();
+   Clause const & ps = ps_smallest ? _qs : _ps;
+   Clause const & qs = ps_smallest ? _ps : _qs;
+   steps += ps.size() * qs.size();
+
+   for (int i = 0; i < qs.size(); i++)
+   {
+      if (qs[i].var() != v)
+      {
+         lbool const val = ig.value(qs[i]);
+         if (val.isTrue())
+            return false;
+         else if (val.isFalse())
+            continue;
+         for (int j = 0; j < ps.size(); j++)
+            if (ps[j].var() == qs[i].var())
+            {
+               if (ps[j] == ~qs[i])
+                  return false;
+               else
+                  goto next;
+            }
+         out_clause.push(qs[i]);
+      }
+      next: ;
+   }
+
+   for (int i = 0; i < ps.size(); i++)
+      if (ps[i].var() != v)
+      {
+         lbool const val = ig.value(ps[i]);
+         if (val.isTrue())
+            return false;
+         else if (!val.isFalse())
+            out_clause.push(ps[i]);
+      }
+
+   return true;
+}
+
+template <typename Propagate>
+template <typename Branch, typename AddFunctor, typename RemoveFunctor>
+inline bool Elimination<Propagate>::run(
+                                        EliminatedClauseDatabase & elimDb,
+                                        Branch & branch,
+                                        AddFunctor const & add,
+                                        RemoveFunctor const & remove)
+{
+   assert(ig.decisionLevel() == 0);
+   candidates.clear();
+   for (Var v = 0; v < touched.size(); ++v)
+   {
+      if (touched[v] && !eliminated[v] && !frozen[v] && branch.isDecisionVar(v)
+         && ig.value(v).isUndef())
+         candidates.push(v);
+      touched[v] = 0;
+   }
+   nTouched = 0;
+   sort(candidates, ElimLt(n_occ));
+
+   for (int i = 0; i < candidates.size(); ++i)
+   {
+      if (steps > maxSteps)
+      {
+         // postpone the remaining candidates to the next round
+         for (; i < candidates.size(); ++i)
+         {
+            nTouched += !touched[candidates[i]];
+            touched[candidates[i]] = 1;
+         }
+         break;
+      }
+      Var const v = candidates[i];
+      if (!eliminated[v] && ig.value(v).isUndef() && !eliminateVar(v, elimDb, branch, add, remove))
+         return false;
+   }
+   steps = 0;
+   ++stat.nInproElimRounds;
+   return true;
+}
+
+template <typename Propagate>
+template <typename Branch, typename AddFunctor, typename RemoveFunctor>
+inline bool Elimination<Propagate>::eliminateVar(
+                                                 Var const v,
+                                                 EliminatedClauseDatabase & elimDb,
+                                                 Branch & branch,
+                                                 AddFunctor const & add,
+                                                 RemoveFunctor const & remove)
+{
+   // Split the original occurrences into positive and negative:
+   //
+   vec<CRef> const & cls = occs[v];
+   pos.clear();
+   neg.clear();
+   for (int i = 0; i < cls.size(); ++i)
+   {
+      Clause const & c = ca[cls[i]];
+      if (c.mark() != 1 && c.getLearnt() == 0)
+         (find(c, Lit(v, false)) ? pos : neg).push(cls[i]);
+   }
+   steps += cls.size();
+
+   // Check whether the increase in number of clauses stays within the allowed ('grow'). Moreover, no
+   // clause must exceed the limit on the maximal clause size (if it is set):
+   //
+   int cnt = 0;
+   for (int i = 0; i < pos.size(); i++)
+      for (int j = 0; j < neg.size(); j++)
+         if (merge(ca[pos[i]], ca[neg[j]], v, resolvent)
+            && (++cnt > pos.size() + neg.size() + grow
+               || (clause_lim != -1 && resolvent.size() > clause_lim)))
+            return true;
+
+   // Delete and store old clauses:
+   eliminated[v] = 1;
+   branch.setDecisionVar(v, false);
+   ++stat.nInproElimVars;
+
+   if (pos.size() > neg.size())
+   {
+      for (int i = 0; i < neg.size(); i++)
+         elimDb.addElimClause(v, ca[neg[i]]);
+      elimDb.addElimUnit(Lit(v, false));
+   } else
+   {
+      for (int i = 0; i < pos.size(); i++)
+         elimDb.addElimClause(v, ca[pos[i]]);
+      elimDb.addElimUnit(Lit(v, true));
+   }
+
+   // Produce clauses in cross product. Adding a clause might reallocate the database, so the
+   // clauses are dereferenced again for each merge:
+   CRef cr;
+   for (int i = 0; i < pos.size(); i++)
+      for (int j = 0; j < neg.size(); j++)
+         if (merge(ca[pos[i]], ca[neg[j]], v, resolvent))
+         {
+            if (!add(resolvent, cr))
+               return false;
+            if (cr != Database::npos())
+               addOccurrences(cr);
+         }
+
+   // Remove original and learnt clauses containing v:
+   for (int i = 0; i < cls.size(); ++i)
+      if (ca[cls[i]].mark() != 1)
+         remove(cls[i]);
+   occs[v].clear(true);
+   return true;
+}
+
+}
+
+#endif /* MINIMIZE_ELIMINATION_H_ */
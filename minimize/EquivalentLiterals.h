@@ -0,0 +1,245 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef MINIMIZE_EQUIVALENTLITERALS_H_
+#define MINIMIZE_EQUIVALENTLITERALS_H_
+
+#include "core/ImplicationGraph.h"
+#include "core/Statistic.h"
+
+namespace ctsat
+{
+
+/**
+ * Finds equivalent literals as strongly connected components of the binary implication graph
+ * (iterative Tarjan). Each component gets a representative, such that the representative of a
+ * negated literal is the negated representative.
+ */
+template <typename Propagate>
+class EquivalentLiterals
+{
+   typedef typename Propagate::Database Database;
+   typedef typename Database::Lit Lit;
+   typedef typename Database::Var Var;
+   typedef typename Database::lbool lbool;
+
+ public:
+   EquivalentLiterals(ImplicationGraph<Database> & ig, Propagate & propEngine);
+
+   // Computes the representatives of the unassigned variables for which isCandidate is true.
+   // Returns false, if a literal is equivalent to its negation.
+   template <typename CandidateFunctor>
+   bool run(CandidateFunctor const & isCandidate);
+
+   // number of variables, which are not their own representative
+   int nSubstituted() const;
+   Lit representative(Lit const l) const;
+   // a literal equivalent to its negation, after run() returned false
+   Lit contradiction() const;
+
+ private:
+   struct Frame
+   {
+      Lit l;
+      int edge;
+      Frame(Lit const l)
+            : l(l),
+              edge(0)
+      {
+      }
+   };
+
+   ImplicationGraph<Database> & ig;
+   Propagate & propEngine;
+
+   int nSubst;
+   int nextIndex;
+   Lit contra;
+   vec<int> index;   // per literal, -1 if not visited
+   vec<int> lowlink;
+   vec<char> onStack;
+   vec<Lit> repr;
+   vec<Lit> sccStack;
+   vec<Frame> callStack;
+
+   template <typename CandidateFunctor>
+   bool visit(Lit const root, CandidateFunctor const & isCandidate);
+   bool closeComponent(Lit const root);
+};
+
+template <typename Propagate>
+inline EquivalentLiterals<Propagate>::EquivalentLiterals(
+                                                         ImplicationGraph<Database> & ig,
+                                                         Propagate & propEngine)
+      : ig(ig),
+        propEngine(propEngine),
+        nSubst(0),
+        nextIndex(0),
+        contra(Lit::Undef())
+{
+}
+
+template <typename Propagate>
+inline int EquivalentLiterals<Propagate>::nSubstituted() const
+{
+   return nSubst;
+}
+
+template <typename Propagate>
+inline typename EquivalentLiterals<Propagate>::Lit EquivalentLiterals<Propagate>::representative(
+                                                                                                 Lit const l) const
+{
+   return (l.toInt() < repr.size()) ? repr[l.toInt()] : l;
+}
+
+template <typename Propagate>
+inline typename EquivalentLiterals<Propagate>::Lit EquivalentLiterals<Propagate>::contradiction() const
+{
+   return contra;
+}
+
+template <typename Propagate>
+template <typename CandidateFunctor>
+bool EquivalentLiterals<Propagate>::run(CandidateFunctor const & isCandidate)
+{
+   int const nLits = 2 * ig.nVars();
+   index.clear();
+   index.growTo(nLits, -1);
+   lowlink.clear();
+   lowlink.growTo(nLits, 0);
+   onStack.clear();
+   onStack.growTo(nLits, 0);
+   repr.clear();
+   for (int i = 0; i < nLits; ++i)
+      repr.push(Lit::toLit(i));
+   nSubst = 0;
+   nextIndex = 0;
+
+   for (Var v = 0; v < ig.nVars(); ++v)
+   {
+      if (!isCandidate(v) || !ig.value(v).isUndef())
+         continue;
+      for (int sign = 0; sign < 2; ++sign)
+         if (index[Lit(v, sign).toInt()] < 0 && !visit(Lit(v, sign), isCandidate))
+            return false;
+   }
+   return true;
+}
+
+template <typename Propagate>
+template <typename CandidateFunctor>
+bool EquivalentLiterals<Propagate>::visit(Lit const root, CandidateFunctor const & isCandidate)
+{
+   callStack.clear();
+   callStack.push(Frame(root));
+   index[root.toInt()] = lowlink[root.toInt()] = nextIndex++;
+   sccStack.push(root);
+   onStack[root.toInt()] = 1;
+
+   while (callStack.size() > 0)
+   {
+      Frame & f = callStack.last();
+      Lit const p = f.l;
+      if (f.edge < propEngine.nBinaryImplications(p))
+      {
+         Lit const q = propEngine.binaryImplication(p, f.edge++);
+         if (q == Lit::Undef() || !ig.value(q).isUndef() || !isCandidate(q.var()))
+            continue;
+         if (index[q.toInt()] < 0)
+         {
+            index[q.toInt()] = lowlink[q.toInt()] = nextIndex++;
+            sccStack.push(q);
+            onStack[q.toInt()] = 1;
+            callStack.push(Frame(q));  // invalidates f
+         } else if (onStack[q.toInt()])
+            lowlink[p.toInt()] = std::min(lowlink[p.toInt()], index[q.toInt()]);
+      } else
+      {
+         callStack.pop();
+         if (lowlink[p.toInt()] == index[p.toInt()] && !closeComponent(p))
+            return false;
+         if (callStack.size() > 0)
+         {
+            Lit const parent = callStack.last().l;
+            lowlink[parent.toInt()] = std::min(lowlink[parent.toInt()], lowlink[p.toInt()]);
+         }
+      }
+   }
+   return true;
+}
+
+// Pops the component of root and assigns the representatives. The representative of the
+// component of the negated literals is reused, if that component is already closed.
+template <typename Propagate>
+bool EquivalentLiterals<Propagate>::closeComponent(Lit const root)
+{
+   int const first = index[root.toInt()];
+   int start = sccStack.size();
+   while (index[sccStack[start - 1].toInt()] > first)
+      --start;
+   --start;
+   assert(sccStack[start] == root);
+
+   // the negated literals form a component as well, which might be closed already
+   Lit const nroot = ~root;
+   bool const negClosed = index[nroot.toInt()] >= 0 && !onStack[nroot.toInt()];
+   Lit r = root;
+   for (int i = start; i < sccStack.size(); ++i)
+   {
+      Lit const l = sccStack[i];
+      if (index[(~l).toInt()] >= first && onStack[(~l).toInt()])
+      {
+         contra = l;  // l and ~l are in the same component
+         return false;
+      }
+      if (l.var() < r.var())
+         r = l;
+   }
+   if (negClosed)
+      r = ~repr[nroot.toInt()];
+   for (int i = start; i < sccStack.size(); ++i)
+   {
+      Lit const l = sccStack[i];
+      onStack[l.toInt()] = 0;
+      repr[l.toInt()] = r;
+      nSubst += !l.sign() && l.var() != r.var();
+   }
+   sccStack.shrink(sccStack.size() - start);
+   return true;
+}
+
+}
+
+#endif /* MINIMIZE_EQUIVALENTLITERALS_H_ */
@@ -0,0 +1,226 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef MINIMIZE_PROBING_H_
+#define MINIMIZE_PROBING_H_
+
+#include "initial/SolverConfig.h"
+#include "core/ImplicationGraph.h"
+#include "core/Statistic.h"
+
+namespace ctsat
+{
+
+/**
+ * Failed literal probing at decision level 0 during search. Only roots of the binary implication
+ * graph, whose variable occurred in a learnt clause since it was probed the last time, are
+ * candidates. Each literal implied through a long clause yields a hyper-binary resolvent with the
+ * probed literal.
+ */
+template <typename Propagate>
+class Probing
+{
+   typedef typename Propagate::Database Database;
+   typedef typename Database::Lit Lit;
+   typedef typename Database::Var Var;
+   typedef typename Database::Clause Clause;
+   typedef typename Database::CRef CRef;
+   typedef typename Database::lbool lbool;
+
+ public:
+   Probing(
+           SolverConfig const & config,
+           Statistic & stat,
+           Database & ca,
+           ImplicationGraph<Database> & ig,
+           Propagate & propEngine);
+
+   void newVar();
+
+   // marks all variables of c as candidates for the next round
+   template <typename LitVec>
+   void touch(LitVec const & c);
+   bool hasTouched() const;
+
+   // Probes the touched roots until the propagations exceed the effort times searchProps. 'unit'
+   // is called with the negation of each failed literal and returns false on a conflict. 'binary'
+   // is called with the two literals of each hyper-binary resolvent. Returns false if unsat was
+   // detected.
+   template <typename Branch, typename UnitFunctor, typename BinaryFunctor>
+   bool run(
+            Branch const & branch,
+            uint64_t const searchProps,
+            UnitFunctor const & unit,
+            BinaryFunctor const & binary);
+
+ private:
+   Statistic & stat;
+   Database & ca;
+   ImplicationGraph<Database> & ig;
+   Propagate & propEngine;
+
+   double const effort;
+   int nTouched;
+
+   vec<char> touched;
+   vec<char> implied;  // literals implied by an earlier probe of the current round
+   vec<Lit> candidates;
+   vec<Lit> resolvents;
+
+   bool isRoot(Lit const p) const;
+};
+
+template <typename Propagate>
+inline Probing<Propagate>::Probing(
+                                   SolverConfig const & config,
+                                   Statistic & stat,
+                                   Database & ca,
+                                   ImplicationGraph<Database> & ig,
+                                   Propagate & propEngine)
+      : stat(stat),
+        ca(ca),
+        ig(ig),
+        propEngine(propEngine),
+        effort(config.probeEffort),
+        nTouched(0)
+{
+}
+
+template <typename Propagate>
+inline void Probing<Propagate>::newVar()
+{
+   touched.push(1);
+   implied.push(0);
+   implied.push(0);
+   ++nTouched;
+}
+
+template <typename Propagate>
+template <typename LitVec>
+inline void Probing<Propagate>::touch(LitVec const & c)
+{
+   for (int i = 0; i < c.size(); ++i)
+   {
+      Var const v = c[i].var();
+      nTouched += !touched[v];
+      touched[v] = 1;
+   }
+}
+
+template <typename Propagate>
+inline bool Probing<Propagate>::hasTouched() const
+{
+   return nTouched > 0;
+}
+
+// p propagates binary clauses, but isn't propagated by one
+template <typename Propagate>
+inline bool Probing<Propagate>::isRoot(Lit const p) const
+{
+   return propEngine.nBinaryImplications(p) > 0 && propEngine.nBinaryImplications(~p) == 0;
+}
+
+template <typename Propagate>
+template <typename Branch, typename UnitFunctor, typename BinaryFunctor>
+bool Probing<Propagate>::run(
+                             Branch const & branch,
+                             uint64_t const searchProps,
+                             UnitFunctor const & unit,
+                             BinaryFunctor const & binary)
+{
+   assert(ig.decisionLevel() == 0);
+   uint64_t const propLimit = stat.s_propagations + static_cast<uint64_t>(effort * searchProps);
+   candidates.clear();
+   for (Var v = 0; v < touched.size(); ++v)
+      if (touched[v] && branch.isDecisionVar(v) && ig.value(v).isUndef())
+         for (int sign = 0; sign < 2; ++sign)
+            if (isRoot(Lit(v, sign)))
+               candidates.push(Lit(v, sign));
+
+   int i = 0;
+   for (; i < candidates.size() && stat.s_propagations < propLimit; ++i)
+   {
+      Lit const p = candidates[i];
+      touched[p.var()] = 0;
+      if (!ig.value(p).isUndef() || implied[p.toInt()])
+         continue;
+
+      ig.newDecisionLevel();
+      propEngine.simpleUncheckEnqueue(p);
+      if (propEngine.simplePropagate() != Database::npos())
+      {
+         propEngine.simpleCancelUntil(0);
+         ++stat.nProbeUnits;
+         if (!unit(~p))
+            return false;
+         continue;
+      }
+
+      resolvents.clear();
+      for (int j = ig.levelEnd(0) + 1; j < ig.nAssigns(); ++j)
+      {
+         Lit const q = ig.getTrailLit(j);
+         CRef const r = ig.reason(q.var());
+         if (r != Database::npos() && ca[r].size() > 2)
+            resolvents.push(q);
+         implied[q.toInt()] = 1;
+      }
+      propEngine.simpleCancelUntil(0);
+      for (int j = 0; j < resolvents.size(); ++j)
+      {
+         ++stat.nProbeBinaries;
+         binary(~p, resolvents[j]);
+      }
+   }
+
+   // remaining candidates are probed in the next round
+   nTouched = 0;
+   for (; i < candidates.size(); ++i)
+      touched[candidates[i].var()] = 1;
+   for (Var v = 0; v < touched.size(); ++v)
+   {
+      if (touched[v] && !ig.value(v).isUndef())
+         touched[v] = 0;
+      nTouched += touched[v];
+   }
+   for (int j = 0; j < implied.size(); ++j)
+      implied[j] = 0;
+   ++stat.nProbeRounds;
+   return true;
+}
+
+}
+
+#endif /* MINIMIZE_PROBING_H_ */
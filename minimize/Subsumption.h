@@ -0,0 +1,260 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef MINIMIZE_SUBSUMPTION_H_
+#define MINIMIZE_SUBSUMPTION_H_
+
+#include "mtl/Sort.h"
+#include "initial/SolverConfig.h"
+#include "core/ImplicationGraph.h"
+#include "core/Statistic.h"
+
+namespace ctsat
+{
+
+/**
+ * Forward subsumption and self-subsuming strengthening of learnt clauses at decision level 0. The
+ * clauses are checked by increasing size against the already checked ones, where each checked
+ * clause is connected to the occurrence list of its rarest literal only (one-watch scheme). The
+ * signatures are computed per round, since learnts keep their activity instead of an abstraction.
+ */
+template <typename Propagate>
+class Subsumption
+{
+   typedef typename Propagate::Database Database;
+   typedef typename Database::Lit Lit;
+   typedef typename Database::Var Var;
+   typedef typename Database::Clause Clause;
+   typedef typename Database::CRef CRef;
+   typedef typename Database::lbool lbool;
+
+ public:
+   Subsumption(SolverConfig const & config, Statistic & stat, Database & ca, ImplicationGraph<Database> & ig);
+
+   void newVar();
+
+   // Checks the clauses until the visited occurrences exceed the effort times searchProps.
+   // 'subsumed' is called with each subsumed clause and the subsuming one. 'strengthen' is called
+   // with a clause and the literal to remove, it returns false on a conflict. Returns false if
+   // unsat was detected.
+   template <typename SubsumedFunctor, typename StrengthenFunctor>
+   bool run(
+            vec<CRef> & clauses,
+            uint64_t const searchProps,
+            SubsumedFunctor const & subsumed,
+            StrengthenFunctor const & strengthen);
+
+ private:
+   struct Occ
+   {
+      CRef cr;
+      uint32_t sig;
+   };
+
+   struct SizeLt
+   {
+      Database const & ca;
+      explicit SizeLt(Database const & ca)
+            : ca(ca)
+      {
+      }
+      bool operator()(CRef const x, CRef const y) const
+      {
+         int const sx = ca[x].size(), sy = ca[y].size();
+         return sx < sy || (sx == sy && x < y);
+      }
+   };
+
+   Statistic & stat;
+   Database & ca;
+   ImplicationGraph<Database> & ig;
+
+   double const effort;
+   uint64_t ticks;
+
+   vec<vec<Occ>> occs;  // per literal
+   vec<char> marks;     // per literal
+   vec<Lit> connected;
+
+   uint32_t signature(Clause const & c) const;
+   // Returns Lit::Undef() if d subsumes the marked clause, the literal to remove if d strengthens
+   // the marked clause and Lit::Error() otherwise.
+   Lit check(Clause const & d);
+   void connect(CRef const cr);
+};
+
+template <typename Propagate>
+inline Subsumption<Propagate>::Subsumption(
+                                           SolverConfig const & config,
+                                           Statistic & stat,
+                                           Database & ca,
+                                           ImplicationGraph<Database> & ig)
+      : stat(stat),
+        ca(ca),
+        ig(ig),
+        effort(config.learntSubEffort),
+        ticks(0)
+{
+}
+
+template <typename Propagate>
+inline void Subsumption<Propagate>::newVar()
+{
+   occs.push();
+   occs.push();
+   marks.push(0);
+   marks.push(0);
+}
+
+template <typename Propagate>
+inline uint32_t Subsumption<Propagate>::signature(Clause const & c) const
+{
+   uint32_t sig = 0;
+   for (int i = 0; i < c.size(); ++i)
+      sig |= 1u << (c[i].var() & 31);
+   return sig;
+}
+
+template <typename Propagate>
+inline typename Subsumption<Propagate>::Lit Subsumption<Propagate>::check(Clause const & d)
+{
+   ticks += d.size();
+   Lit res = Lit::Undef();
+   for (int i = 0; i < d.size(); ++i)
+   {
+      if (marks[d[i].toInt()])
+         continue;
+      else if (res == Lit::Undef() && marks[(~d[i]).toInt()])
+         res = ~d[i];
+      else
+         return Lit::Error();
+   }
+   return res;
+}
+
+template <typename Propagate>
+inline void Subsumption<Propagate>::connect(CRef const cr)
+{
+   Clause const & c = ca[cr];
+   Lit best = c[0];
+   for (int i = 1; i < c.size(); ++i)
+      if (occs[c[i].toInt()].size() < occs[best.toInt()].size())
+         best = c[i];
+   if (occs[best.toInt()].size() == 0)
+      connected.push(best);
+   occs[best.toInt()].push(Occ { cr, signature(c) });
+}
+
+template <typename Propagate>
+template <typename SubsumedFunctor, typename StrengthenFunctor>
+bool Subsumption<Propagate>::run(
+                                 vec<CRef> & clauses,
+                                 uint64_t const searchProps,
+                                 SubsumedFunctor const & subsumed,
+                                 StrengthenFunctor const & strengthen)
+{
+   assert(ig.decisionLevel() == 0);
+   uint64_t const tickLimit = static_cast<uint64_t>(effort * searchProps);
+   ticks = 0;
+   sort(clauses, SizeLt(ca));
+
+   bool res = true;
+   for (int i = 0; i < clauses.size() && ticks < tickLimit; ++i)
+   {
+      CRef const cr = clauses[i];
+      if (i > 0 && cr == clauses[i - 1])
+         continue;  // the reduce tiers might contain a clause twice
+      Clause const & c = ca[cr];
+      if (c.mark() == 1 || ig.satisfied(c))
+         continue;
+
+      uint32_t const sig = signature(c);
+      for (int j = 0; j < c.size(); ++j)
+         marks[c[j].toInt()] = 1;
+
+      CRef by = Database::npos();
+      Lit rm = Lit::Error();
+      for (int j = 0; j < 2 * c.size() && rm == Lit::Error(); ++j)
+      {
+         Lit const l = (j & 1) ? ~c[j >> 1] : c[j >> 1];
+         vec<Occ> const & os = occs[l.toInt()];
+         ticks += os.size();
+         for (int k = 0; k < os.size(); ++k)
+         {
+            if ((os[k].sig & ~sig) != 0)
+               continue;
+            Clause const & d = ca[os[k].cr];
+            if (d.mark() == 1 || d.size() > c.size())
+               continue;
+            rm = check(d);
+            if (rm != Lit::Error())
+            {
+               by = os[k].cr;
+               break;
+            }
+         }
+      }
+      for (int j = 0; j < c.size(); ++j)
+         marks[c[j].toInt()] = 0;
+
+      if (rm == Lit::Undef())
+      {
+         ++stat.nSubsumedLearnts;
+         subsumed(cr, by);
+         continue;
+      } else if (rm != Lit::Error())
+      {
+         ++stat.nStrengthenedLearnts;
+         if (!strengthen(cr, rm))
+         {
+            res = false;
+            break;
+         }
+         if (ca[cr].mark() == 1)
+            continue;
+      }
+      connect(cr);
+   }
+
+   for (int i = 0; i < connected.size(); ++i)
+      occs[connected[i].toInt()].clear();
+   connected.clear();
+   ++stat.nSubsumeRounds;
+   return res;
+}
+
+}
+
+#endif /* MINIMIZE_SUBSUMPTION_H_ */
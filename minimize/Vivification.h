@@ -36,21 +36,75 @@ class Vivification
 
    Vivification(
                 SolverConfig const & config,
+                Statistic & stat,
                 Database & ca,
                 ImplicationGraph<Database> & ig,
                 Propagate & propEngine);
 
-   bool run(Clause& c);
+   // Sorts the candidates by their literals in the order of occurrence, so consecutive clauses
+   // share a prefix of decisions. The order stays valid until the next call.
+   void schedule(vec<CRef> & candidates);
+
+   // Vivifies the detached clause c. The decisions of the previous call, which are shared with c,
+   // are kept on the trail and have to be removed with resetTrail before level 0 is changed.
+   bool run(Clause& c, CRef const cr);
+   void resetTrail();
+
+   bool rootSatisfied(Clause const & c) const;
 
    template <typename ClauseType>
-   PropagateResult propagateClause(ClauseType const & c);
+   PropagateResult propagateClause(ClauseType const & c, int const startIdx = 0);
+
+   double localEffort;  // propagations for local clauses relative to search propagations
 
  private:
+   struct LitOrderLt
+   {
+      vec<int> const & occs;
+      explicit LitOrderLt(vec<int> const & occs)
+            : occs(occs)
+      {
+      }
+      bool operator()(Lit const x, Lit const y) const
+      {
+         return occs[x.toInt()] > occs[y.toInt()] || (occs[x.toInt()] == occs[y.toInt()] && x < y);
+      }
+   };
+
+   struct ScheduleLt
+   {
+      vec<Lit> const & lits;
+      vec<int> const & starts;
+      LitOrderLt const lt;
+      ScheduleLt(vec<Lit> const & lits, vec<int> const & starts, vec<int> const & occs)
+            : lits(lits),
+              starts(starts),
+              lt(occs)
+      {
+      }
+      bool operator()(int const x, int const y) const
+      {
+         int i = starts[x], j = starts[y];
+         for (; i < starts[x + 1] && j < starts[y + 1]; ++i, ++j)
+            if (lits[i] != lits[j])
+               return lt(lits[i], lits[j]);
+         return i == starts[x + 1] && j < starts[y + 1];
+      }
+   };
+
+   Statistic & stat;
    Database & ca;
    ImplicationGraph<Database> & ig;
    Propagate & propEngine;
 
+   vec<int> litOccs;
    vec<Lit> simp_learnt_clause;
+   vec<Lit> sortedLits;
+   vec<int> starts;
+   vec<int> order;
+   vec<CRef> tmpCandidates;
+
+   int sharedDecisions(Clause const & c, CRef const cr, int & startIdx) const;
 
    // returns lbd
    int simpleAnalyze(CRef confl, vec<Lit>& c, bool const True_confl);
@@ -59,30 +113,117 @@ class Vivification
 template <typename Propagate>
 inline Vivification<Propagate>::Vivification(
                                              const SolverConfig& config,
+                                             Statistic & stat,
                                              Database & ca,
                                              ImplicationGraph<Database>& ig,
                                              Propagate& propEngine)
-      : ca(ca),
+      : localEffort(config.viviLocalEffort),
+        stat(stat),
+        ca(ca),
         ig(ig),
         propEngine(propEngine)
 {
 }
 
+template <typename Propagate>
+void Vivification<Propagate>::schedule(vec<CRef> & candidates)
+{
+   if (litOccs.size() < 2 * ig.nVars())
+      litOccs.growTo(2 * ig.nVars(), 0);
+   for (int i = 0; i < litOccs.size(); ++i)
+      litOccs[i] = 0;
+   for (int i = 0; i < candidates.size(); ++i)
+   {
+      Clause const & c = ca[candidates[i]];
+      for (int j = 0; j < c.size(); ++j)
+         ++litOccs[c[j].toInt()];
+   }
+
+   LitOrderLt const lt(litOccs);
+   sortedLits.clear();
+   starts.clear();
+   order.clear();
+   for (int i = 0; i < candidates.size(); ++i)
+   {
+      Clause const & c = ca[candidates[i]];
+      starts.push(sortedLits.size());
+      order.push(i);
+      for (int j = 0; j < c.size(); ++j)
+         sortedLits.push(c[j]);
+      // insertion sort, since most learnt clauses are short
+      for (int j = starts.last() + 1; j < sortedLits.size(); ++j)
+      {
+         Lit const l = sortedLits[j];
+         int k = j;
+         for (; k > starts.last() && lt(l, sortedLits[k - 1]); --k)
+            sortedLits[k] = sortedLits[k - 1];
+         sortedLits[k] = l;
+      }
+   }
+   starts.push(sortedLits.size());
+
+   sort(order, ScheduleLt(sortedLits, starts, litOccs));
+   candidates.copyTo(tmpCandidates);
+   for (int i = 0; i < order.size(); ++i)
+      candidates[i] = tmpCandidates[order[i]];
+}
+
+template <typename Propagate>
+inline bool Vivification<Propagate>::rootSatisfied(Clause const & c) const
+{
+   for (int i = 0; i < c.size(); ++i)
+      if (ig.value(c[i]).isTrue() && ig.level(c[i]) == 0)
+         return true;
+   return false;
+}
+
+template <typename Propagate>
+inline void Vivification<Propagate>::resetTrail()
+{
+   if (ig.decisionLevel() > 0)
+      propEngine.simpleCancelUntil(0);
+}
+
+// Returns the number of decision levels that are also decisions when propagating c from scratch.
+// startIdx is set to the first literal of c that is not decided on or implied by these levels.
+template <typename Propagate>
+int Vivification<Propagate>::sharedDecisions(Clause const & c, CRef const cr, int & startIdx) const
+{
+   // the clause was attached while the trail was build, so everything it implied is invalid
+   int maxLevel = ig.decisionLevel();
+   for (int i = 0; i < c.size(); ++i)
+      if (ig.value(c[i]).isTrue() && ig.reason(c[i]) == cr)
+         maxLevel = std::min(maxLevel, ig.level(c[i]) - 1);
+
+   int level = 0;
+   for (startIdx = 0; startIdx < c.size(); ++startIdx)
+   {
+      Lit const l = c[startIdx];
+      if (level < maxLevel && ig.getTrailLit(ig.levelEnd(level)) == ~l)
+         ++level;
+      else if (!ig.value(l).isFalse() || ig.level(l) > level)
+         break;
+   }
+   return level;
+}
+
 template <typename Propagate>
 template <typename ClauseType>
 inline typename Vivification<Propagate>::PropagateResult Vivification<Propagate>::propagateClause(
-                                                                                           ClauseType const & c)
+                                                                                           ClauseType const & c,
+                                                                                           int const startIdx)
 {
    PropagateResult res;
    res.isTruePropagation = false;
    res.confl = Database::npos();
-   res.numProps = 0;
+   res.numProps = ig.decisionLevel();
 
-   for (int i = 0; i < c.size(); ++i)
+   for (int i = startIdx; i < c.size(); ++i)
    {
       if (ig.value(c[i]).isUndef())
       {
          ++res.numProps;
+         ig.newDecisionLevel();
          propEngine.simpleUncheckEnqueue(~c[i]);
          if ((res.confl = propEngine.simplePropagate()) != Database::npos())
             break;
@@ -104,13 +245,31 @@ inline typename Vivification<Propagate>::PropagateResult Vivification<Propagate>
 }
 
 template <typename Propagate>
-inline bool Vivification<Propagate>::run(Clause& c)
+inline bool Vivification<Propagate>::run(Clause& c, CRef const cr)
 {
-
    const int initSize = c.size();
-   propEngine.trailRecord = ig.nAssigns();      // record the start pointer
 
-   PropagateResult pr = propagateClause(c);
+   // order the literals like in schedule and drop the ones falsified on level 0
+   simp_learnt_clause.clear();
+   for (int i = 0; i < c.size(); ++i)
+      if (!ig.value(c[i]).isFalse() || ig.level(c[i]) > 0)
+         simp_learnt_clause.push(c[i]);
+   if (litOccs.size() == 2 * ig.nVars())
+      sort(simp_learnt_clause, LitOrderLt(litOccs));
+   for (int i = 0; i < simp_learnt_clause.size(); ++i)
+      c[i] = simp_learnt_clause[i];
+   c.shrink(c.size() - simp_learnt_clause.size());
+
+   int startIdx = 0;
+   int const shared = sharedDecisions(c, cr, startIdx);
+   if (shared < ig.decisionLevel())
+      propEngine.simpleCancelUntil(shared);
+   propEngine.trailRecord = (shared > 0) ? ig.levelEnd(0) : ig.nAssigns();      // record the start pointer
+   stat.nViviReusedDecisions += shared;
+
+   PropagateResult pr = propagateClause(c, startIdx);
+   stat.nViviDecisions += pr.numProps;
+   ++stat.nViviClauses;
 
    if (pr.confl != Database::npos())
    {
@@ -126,6 +285,9 @@ inline bool Vivification<Propagate>::run(Clause& c)
             c[i] = simp_learnt_clause[i];
          c.shrink(c.size() - i);
       }
+      // the conflicting level is incomplete, so it can't be shared
+      if (!pr.isTruePropagation)
+         propEngine.simpleCancelUntil(ig.decisionLevel() - 1);
    }
    else if(pr.numProps < c.size())
    {
@@ -138,11 +300,15 @@ inline bool Vivification<Propagate>::run(Clause& c)
       }
       c.shrink(i-j);
    }
-   propEngine.cancelUntilTrailRecord();
 
    if (pr.numProps < c.lbd())
       c.set_lbd(pr.numProps);
-   return c.size() < initSize;
+   if (c.size() < initSize)
+   {
+      ++stat.nViviStrengthened;
+      return true;
+   }
+   return false;
 }
 
 template <typename Propagate>
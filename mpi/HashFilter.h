@@ -21,7 +21,12 @@ class HashFilter
    template <typename ClauseType>
    bool add(ClauseType const & c)
    {
-      size_t const hash = generateHash(c);
+      return addHash(generateHash(c));
+   }
+
+   // For clauses, which already carry a hash.
+   bool addHash(size_t const hash)
+   {
       auto it = cHashes.find(hash);
       if(it == cHashes.end())
       {
@@ -139,9 +139,9 @@ class MPIBroadcastConnector : public AtomicConnector
    }
 
    template <typename ClauseType, typename ... Args>
-   inline bool exchange(uint64_t const & nBytes, Args ... args)
+   inline bool exchange(unsigned const producer, uint64_t const & nBytes, Args ... args)
    {
-      return AtomicConnector::exchange<ClauseType, Args...>(nBytes, args...);
+      return AtomicConnector::exchange<ClauseType, Args...>(producer, nBytes, args...);
    }
 
    inline uint64_t nFreeSendBytes() const
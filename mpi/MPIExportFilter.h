@@ -123,7 +123,7 @@ inline void MPIExportFilter<Database>::readRecvClauses()
          uint64_t const nBytes = EClause::nbytes(e);
          assert(nBytes % sizeof(base_type) == 0);
          p += nBytes;
-         if(useHashes && hFilter.add(e))
+         if(useHashes && hFilter.addHash(e.hash))
          {
             ++statistic.hashFiltered;
             continue;
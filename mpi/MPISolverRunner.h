@@ -238,7 +238,9 @@ LOG("Filter thread " + std::to_string(pthread_self()) + " started")
       LOG("Sending instance")
       uint64_t nBytes = 0;
       void const * data = nullptr;
-      mem.inst = getInstance((*Inputs::argv)[1], SolverConfig::getInputConfig());
+      SolverConfig config = SolverConfig::getInputConfig();
+      config.preproThreads = Inputs::nThreads;
+      mem.inst = getInstance((*Inputs::argv)[1], config);
       if (mem.inst.isOk())
       {
          nBytes = mem.inst.ca.nBytes();
@@ -397,8 +399,7 @@ LOG("Filter thread " + std::to_string(pthread_self()) + " started")
                   inst.model[i] = (inst.isDecisionVar[i]) ? model[i] : inst.model[i];
                }
                if (Inputs::verifySat
-                  && !ModelChecker::checkSat(inst.model, (*Inputs::argv)[1], inst.isDecisionVar,
-                                             true))
+                  && !checkModel(inst.model, inst, Inputs::nThreads, true))
                {
                   std::cout << "c SAT solution is before extend wrong\n";
                   if(!inst.checkModel())
@@ -410,10 +411,10 @@ LOG("Filter thread " + std::to_string(pthread_self()) + " started")
 
                elimDb.extendModel(inst.model);
                if (Inputs::model)
-                  elimDb.printModel(inst.model);
+                  printModel(inst.model, elimDb);
                if (Inputs::verifySat)
                {
-                  if (ModelChecker::checkSat(inst.model, (*Inputs::argv)[1], inst.isDecisionVar))
+                  if (checkModel(inst.model, inst, Inputs::nThreads))
                      std::cout << "c SAT solution is correct\n";
                   else
                   {
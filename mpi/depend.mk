@@ -0,0 +1,160 @@
+/root/repo/mpi/Main.o /root/repo/mpi/Main.or /root/repo/mpi/Main.od /root/repo/mpi/Main.op: /root/repo/mpi/Main.cc ../mpi/MPISolverRunner.h \
+ ../core/SolverRunner.h ../utils/System.h ../utils/ParseUtils.h \
+ ../utils/DecompressReader.h ../utils/ResourceLimits.h ../utils/Options.h \
+ ../mtl/Vec.h ../mtl/XAlloc.h ../utils/Exceptions.h ../initial/Inputs.h \
+ ../initial/SatInstance.h ../utils/DratPrint.h ../utils/ProofWriter.h \
+ ../initial/EliminatedClauseDatabase.h ../database/MinisatAllocatorDb.h \
+ ../database/BasicTypes.h ../mtl/Alloc.h ../mtl/Alg.h \
+ ../initial/InstanceCache.h ../initial/SolverConfig.h ../utils/CPUBind.h \
+ ../initial/Preprocessor.h ../mtl/Queue.h ../mtl/Heap.h ../mtl/OccLists.h \
+ ../core/ImplicationGraph.h ../mtl/Sort.h ../core/Statistic.h \
+ ../branch/Branch.h ../utils/Random.h ../core/SolveMode.h \
+ ../propagate/MiniSatPropagate.h ../propagate/GaussJordan.h \
+ ../minimize/EquivalentLiterals.h ../utils/ParallelFor.h \
+ ../utils/MappedFile.h ../initial/EliminatedClauseDatabase.h \
+ ../core/ModelChecker.h ../core/Solver.h ../mtl/AvgQueue.h \
+ ../minimize/Vivification.h ../minimize/Elimination.h \
+ ../minimize/Probing.h ../minimize/Subsumption.h \
+ ../analyze/FirstUipAnalyze.h ../minimize/BasicInprocess.h \
+ ../branch/DistLrbVsidsBranch.h ../utils/Timer.h ../branch/Dist.h \
+ ../branch/Vsids.h ../branch/Lrb.h ../reduce/ChanseokOh.h \
+ ../reduce/Glucose.h ../restart/GlucoseLuby.h ../restart/Glucose.h \
+ ../restart/Luby.h ../core/NoConnector.h ../exchange/NoClauseExchanger.h \
+ ../exchange/SimpleClauseExchanger.h ../exchange/ExportClause.h \
+ ../exchange/ConflictExchange.h ../analyze/MultiUipAnalyze.h \
+ ../analyze/LevelAwareAnalyze.h ../analyze/ConflictCore.h \
+ ../core/Solver_impl.hpp ../utils/Logger.h ../parallel/CubeQueue.h \
+ ../mpi/MPIBroadcastConnector.h ../parallel/AtomicConnector.h \
+ ../parallel/AtomicRingAllocator.h ../mpi/MPIStatistc.h \
+ ../parallel/ParallelStatistic.h ../mpi/MPIHelper.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/mpi.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/mpi_portable_platform.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/mpicxx.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/constants.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/functions.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/datatype.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/exception.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/op.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/status.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/request.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/group.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/comm.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/win.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/file.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/errhandler.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/intracomm.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/topology.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/intercomm.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/info.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/datatype_inln.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/functions_inln.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/request_inln.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/comm_inln.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/intracomm_inln.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/topology_inln.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/intercomm_inln.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/group_inln.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/op_inln.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/errhandler_inln.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/status_inln.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/info_inln.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/win_inln.h \
+ /usr/lib/x86_64-linux-gnu/openmpi/include/openmpi/ompi/mpi/cxx/file_inln.h \
+ ../mpi/MPIExportFilter.h ../mpi/HashFilter.h ../mpi/MPISatDistributor.h \
+ ../mpi/MPIPartitioner.h
+/root/repo/core/Main.o /root/repo/core/Main.or /root/repo/core/Main.od /root/repo/core/Main.op: /root/repo/core/Main.cc ../core/SolverRunner.h ../utils/System.h \
+ ../utils/ParseUtils.h ../utils/DecompressReader.h \
+ ../utils/ResourceLimits.h ../utils/Options.h ../mtl/Vec.h \
+ ../mtl/XAlloc.h ../utils/Exceptions.h ../initial/Inputs.h \
+ ../initial/SatInstance.h ../utils/DratPrint.h ../utils/ProofWriter.h \
+ ../initial/EliminatedClauseDatabase.h ../database/MinisatAllocatorDb.h \
+ ../database/BasicTypes.h ../mtl/Alloc.h ../mtl/Alg.h \
+ ../initial/InstanceCache.h ../initial/SolverConfig.h ../utils/CPUBind.h \
+ ../initial/Preprocessor.h ../mtl/Queue.h ../mtl/Heap.h ../mtl/OccLists.h \
+ ../core/ImplicationGraph.h ../mtl/Sort.h ../core/Statistic.h \
+ ../branch/Branch.h ../utils/Random.h ../core/SolveMode.h \
+ ../propagate/MiniSatPropagate.h ../propagate/GaussJordan.h \
+ ../minimize/EquivalentLiterals.h ../utils/ParallelFor.h \
+ ../utils/MappedFile.h ../initial/EliminatedClauseDatabase.h \
+ ../core/ModelChecker.h ../core/Solver.h ../mtl/AvgQueue.h \
+ ../minimize/Vivification.h ../minimize/Elimination.h \
+ ../minimize/Probing.h ../minimize/Subsumption.h \
+ ../analyze/FirstUipAnalyze.h ../minimize/BasicInprocess.h \
+ ../branch/DistLrbVsidsBranch.h ../utils/Timer.h ../branch/Dist.h \
+ ../branch/Vsids.h ../branch/Lrb.h ../reduce/ChanseokOh.h \
+ ../reduce/Glucose.h ../restart/GlucoseLuby.h ../restart/Glucose.h \
+ ../restart/Luby.h ../core/NoConnector.h ../exchange/NoClauseExchanger.h \
+ ../exchange/SimpleClauseExchanger.h ../exchange/ExportClause.h \
+ ../exchange/ConflictExchange.h ../analyze/MultiUipAnalyze.h \
+ ../analyze/LevelAwareAnalyze.h ../analyze/ConflictCore.h \
+ ../core/Solver_impl.hpp ../utils/Logger.h ../parallel/CubeQueue.h
+/root/repo/core/ModelChecker.o /root/repo/core/ModelChecker.or /root/repo/core/ModelChecker.od /root/repo/core/ModelChecker.op: /root/repo/core/ModelChecker.cc ../core/ModelChecker.h \
+ ../database/BasicTypes.h ../mtl/Vec.h ../mtl/XAlloc.h \
+ ../utils/Exceptions.h ../utils/ParseUtils.h ../utils/DecompressReader.h \
+ ../utils/ParallelFor.h
+/root/repo/core/NoConnector.o /root/repo/core/NoConnector.or /root/repo/core/NoConnector.od /root/repo/core/NoConnector.op: /root/repo/core/NoConnector.cc ../core/NoConnector.h \
+ ../mtl/Vec.h ../mtl/XAlloc.h ../utils/Exceptions.h \
+ ../database/BasicTypes.h
+/root/repo/parallel/Main.o /root/repo/parallel/Main.or /root/repo/parallel/Main.od /root/repo/parallel/Main.op: /root/repo/parallel/Main.cc ../parallel/RingConnector.h \
+ ../parallel/ClauseFilter.h ../mtl/XAlloc.h ../utils/Exceptions.h \
+ ../parallel/SpmcRing.h ../mtl/Vec.h ../core/NoConnector.h \
+ ../database/BasicTypes.h ../parallel/ParallelSolveRunner.h \
+ ../core/SolverRunner.h ../utils/System.h ../utils/ParseUtils.h \
+ ../utils/DecompressReader.h ../utils/ResourceLimits.h ../utils/Options.h \
+ ../initial/Inputs.h ../initial/SatInstance.h ../utils/DratPrint.h \
+ ../utils/ProofWriter.h ../initial/EliminatedClauseDatabase.h \
+ ../database/MinisatAllocatorDb.h ../mtl/Alloc.h ../mtl/Alg.h \
+ ../initial/InstanceCache.h ../initial/SolverConfig.h ../utils/CPUBind.h \
+ ../initial/Preprocessor.h ../mtl/Queue.h ../mtl/Heap.h ../mtl/OccLists.h \
+ ../core/ImplicationGraph.h ../mtl/Sort.h ../core/Statistic.h \
+ ../branch/Branch.h ../utils/Random.h ../core/SolveMode.h \
+ ../propagate/MiniSatPropagate.h ../propagate/GaussJordan.h \
+ ../minimize/EquivalentLiterals.h ../utils/ParallelFor.h \
+ ../utils/MappedFile.h ../initial/EliminatedClauseDatabase.h \
+ ../core/ModelChecker.h ../core/Solver.h ../mtl/AvgQueue.h \
+ ../minimize/Vivification.h ../minimize/Elimination.h \
+ ../minimize/Probing.h ../minimize/Subsumption.h \
+ ../analyze/FirstUipAnalyze.h ../minimize/BasicInprocess.h \
+ ../branch/DistLrbVsidsBranch.h ../utils/Timer.h ../branch/Dist.h \
+ ../branch/Vsids.h ../branch/Lrb.h ../reduce/ChanseokOh.h \
+ ../reduce/Glucose.h ../restart/GlucoseLuby.h ../restart/Glucose.h \
+ ../restart/Luby.h ../exchange/NoClauseExchanger.h \
+ ../exchange/SimpleClauseExchanger.h ../exchange/ExportClause.h \
+ ../exchange/ConflictExchange.h ../analyze/MultiUipAnalyze.h \
+ ../analyze/LevelAwareAnalyze.h ../analyze/ConflictCore.h \
+ ../core/Solver_impl.hpp ../utils/Logger.h ../parallel/CubeQueue.h \
+ ../parallel/ParallelStatistic.h ../parallel/AtomicConnector.h \
+ ../parallel/AtomicRingAllocator.h ../utils/ProofMerger.h
+/root/repo/core/Main.o /root/repo/core/Main.or /root/repo/core/Main.od /root/repo/core/Main.op: /root/repo/core/Main.cc ../core/SolverRunner.h ../utils/System.h \
+ ../utils/ParseUtils.h ../utils/DecompressReader.h \
+ ../utils/ResourceLimits.h ../utils/Options.h ../mtl/Vec.h \
+ ../mtl/XAlloc.h ../utils/Exceptions.h ../initial/Inputs.h \
+ ../initial/SatInstance.h ../utils/DratPrint.h ../utils/ProofWriter.h \
+ ../initial/EliminatedClauseDatabase.h ../database/MinisatAllocatorDb.h \
+ ../database/BasicTypes.h ../mtl/Alloc.h ../mtl/Alg.h \
+ ../initial/InstanceCache.h ../initial/SolverConfig.h ../utils/CPUBind.h \
+ ../initial/Preprocessor.h ../mtl/Queue.h ../mtl/Heap.h ../mtl/OccLists.h \
+ ../core/ImplicationGraph.h ../mtl/Sort.h ../core/Statistic.h \
+ ../branch/Branch.h ../utils/Random.h ../core/SolveMode.h \
+ ../propagate/MiniSatPropagate.h ../propagate/GaussJordan.h \
+ ../minimize/EquivalentLiterals.h ../utils/ParallelFor.h \
+ ../utils/MappedFile.h ../initial/EliminatedClauseDatabase.h \
+ ../core/ModelChecker.h ../core/Solver.h ../mtl/AvgQueue.h \
+ ../minimize/Vivification.h ../minimize/Elimination.h \
+ ../minimize/Probing.h ../minimize/Subsumption.h \
+ ../analyze/FirstUipAnalyze.h ../minimize/BasicInprocess.h \
+ ../branch/DistLrbVsidsBranch.h ../utils/Timer.h ../branch/Dist.h \
+ ../branch/Vsids.h ../branch/Lrb.h ../reduce/ChanseokOh.h \
+ ../reduce/Glucose.h ../restart/GlucoseLuby.h ../restart/Glucose.h \
+ ../restart/Luby.h ../core/NoConnector.h ../exchange/NoClauseExchanger.h \
+ ../exchange/SimpleClauseExchanger.h ../exchange/ExportClause.h \
+ ../exchange/ConflictExchange.h ../analyze/MultiUipAnalyze.h \
+ ../analyze/LevelAwareAnalyze.h ../analyze/ConflictCore.h \
+ ../core/Solver_impl.hpp ../utils/Logger.h ../parallel/CubeQueue.h
+/root/repo/core/ModelChecker.o /root/repo/core/ModelChecker.or /root/repo/core/ModelChecker.od /root/repo/core/ModelChecker.op: /root/repo/core/ModelChecker.cc ../core/ModelChecker.h \
+ ../database/BasicTypes.h ../mtl/Vec.h ../mtl/XAlloc.h \
+ ../utils/Exceptions.h ../utils/ParseUtils.h ../utils/DecompressReader.h \
+ ../utils/ParallelFor.h
+/root/repo/core/NoConnector.o /root/repo/core/NoConnector.or /root/repo/core/NoConnector.od /root/repo/core/NoConnector.op: /root/repo/core/NoConnector.cc ../core/NoConnector.h \
+ ../mtl/Vec.h ../mtl/XAlloc.h ../utils/Exceptions.h \
+ ../database/BasicTypes.h
@@ -28,6 +28,18 @@ COPTIMIZE ?= -O3
 CFLAGS    += -I$(MROOT) -D __STDC_LIMIT_MACROS -D __STDC_FORMAT_MACROS
 LFLAGS    += -lz
 
+## Optional decompression libraries for xz and bzip2 compressed input
+HAS_LZMA  ?= $(shell printf '\043include <lzma.h>\n' | $(CXX) -E -x c++ - >/dev/null 2>&1 && echo 1)
+HAS_BZIP2 ?= $(shell printf '\043include <stdio.h>\n\043include <bzlib.h>\n' | $(CXX) -E -x c++ - >/dev/null 2>&1 && echo 1)
+ifeq ($(HAS_LZMA),1)
+CFLAGS    += -D CTSAT_LZMA
+LFLAGS    += -llzma
+endif
+ifeq ($(HAS_BZIP2),1)
+CFLAGS    += -D CTSAT_BZIP2
+LFLAGS    += -lbz2
+endif
+
 .PHONY : s p d r rs sa clean 
 
 s:	$(EXEC)
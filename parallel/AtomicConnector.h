@@ -70,7 +70,7 @@ class AtomicConnector : public NoConnector
    }
 
    template <typename ClauseType, typename ... Args>
-   inline bool exchange(size_type const & nBytes, Args ... args)
+   inline bool exchange(unsigned const producer, size_type const & nBytes, Args ... args)
    {
       return ara.allocConstruct<ClauseType, Args...>(nBytes, args...);
    }
@@ -0,0 +1,123 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef SOURCES_PARALLEL_CLAUSEFILTER_H_
+#define SOURCES_PARALLEL_CLAUSEFILTER_H_
+
+#include <cstdint>
+#include <cstdlib>
+#include <atomic>
+#include <cassert>
+
+#include "mtl/XAlloc.h"
+
+namespace ctsat
+{
+
+// Remembers the hashes of the recently exported clauses of all threads, so a clause learnt by
+// several threads is only exported once. The table is split into buckets of one cache line. Every
+// entry holds a hash and the epoch of its insertion. An epoch passes after epochLength inserts and
+// entries older than maxAge epochs are replaced first. Concurrent inserts of the same hash may both
+// succeed, which only lets a duplicate through.
+class ClauseFilter
+{
+   ClauseFilter(ClauseFilter const &) = delete;
+   ClauseFilter(ClauseFilter &&) = delete;
+   ClauseFilter & operator=(ClauseFilter const &) = delete;
+   ClauseFilter & operator=(ClauseFilter &&) = delete;
+
+ public:
+   ClauseFilter();
+   ~ClauseFilter();
+
+   // Returns true, when the hash was inserted within the last maxAge epochs. Otherwise it is
+   // inserted.
+   bool insert(uint32_t const hash);
+
+ private:
+   static const unsigned bucketSize = 8;  // 64 bytes
+   static const unsigned nBuckets = 1 << 14;
+   static const unsigned epochShift = 10;
+   static const uint32_t maxAge = 64;
+
+   std::atomic<uint64_t> nInserts;
+   std::atomic<uint64_t> * table;
+};
+
+inline ClauseFilter::ClauseFilter()
+      : nInserts(0),
+        table(nullptr)
+{
+   static_assert(maxAge << epochShift <= nBuckets * bucketSize / 2, "the table is too small");
+   table = reinterpret_cast<std::atomic<uint64_t>*>(xaligned_alloc(
+         bucketSize * sizeof(std::atomic<uint64_t>), nBuckets * bucketSize * sizeof(std::atomic<uint64_t>)));
+   for (unsigned i = 0; i < nBuckets * bucketSize; ++i)
+      table[i].store(0, std::memory_order_relaxed);
+}
+
+inline ClauseFilter::~ClauseFilter()
+{
+   free(table);
+}
+
+inline bool ClauseFilter::insert(uint32_t const hash)
+{
+   // epochs start at 1, so a zero entry is empty
+   uint32_t const epoch = 1 + (nInserts.fetch_add(1, std::memory_order_relaxed) >> epochShift);
+   std::atomic<uint64_t> * bucket = table + (hash % nBuckets) * bucketSize;
+   unsigned oldest = 0;
+   uint32_t oldestAge = 0;
+   uint64_t oldestEntry = 0;
+   for (unsigned i = 0; i < bucketSize; ++i)
+   {
+      uint64_t const entry = bucket[i].load(std::memory_order_relaxed);
+      uint32_t const entryEpoch = static_cast<uint32_t>(entry);
+      uint32_t const age = (entry == 0) ? UINT32_MAX : (epoch > entryEpoch) ? epoch - entryEpoch : 0;
+      if (static_cast<uint32_t>(entry >> 32) == hash && age < maxAge)
+         return true;
+      if (age >= oldestAge)
+      {
+         oldest = i;
+         oldestAge = age;
+         oldestEntry = entry;
+      }
+   }
+   bucket[oldest].compare_exchange_strong(oldestEntry, (static_cast<uint64_t>(hash) << 32) | epoch,
+                                          std::memory_order_relaxed);
+   return false;
+}
+}
+
+#endif /* SOURCES_PARALLEL_CLAUSEFILTER_H_ */
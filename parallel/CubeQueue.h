@@ -0,0 +1,154 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef SOURCES_PARALLEL_CUBEQUEUE_H_
+#define SOURCES_PARALLEL_CUBEQUEUE_H_
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "mtl/Vec.h"
+#include "database/BasicTypes.h"
+
+namespace ctsat
+{
+
+// The open cubes of the cube-and-conquer mode. Threads take a cube, solve the formula under it and
+// may split it into two cubes, when other threads are idle. The cubes are taken in the order they
+// were added, so idle threads get the shortest, i.e. largest, open cube. The search space is
+// exhausted, when no cube is open and no thread works on one.
+class CubeQueue
+{
+   CubeQueue(CubeQueue const &) = delete;
+   CubeQueue(CubeQueue &&) = delete;
+   CubeQueue & operator=(CubeQueue const &) = delete;
+   CubeQueue & operator=(CubeQueue &&) = delete;
+
+ public:
+   // Starts with the empty cube.
+   CubeQueue();
+
+   // Blocks until a cube is open and moves it to cube. Returns false, when the search space is
+   // exhausted or isStopped() returns true.
+   template <typename Stop>
+   bool take(vec<Lit> & cube, Stop const & isStopped);
+
+   // Adds a cube split off from the cube of the calling thread.
+   void add(vec<Lit> const & cube);
+
+   // The calling thread finished its cube.
+   void done();
+
+   // Returns true, when more threads wait for a cube than cubes are open.
+   bool needsCubes() const;
+
+   bool isExhausted() const;
+
+ private:
+   mutable std::mutex mtx;
+   std::condition_variable cv;
+   std::deque<std::vector<Lit>> open;
+   std::atomic<int> nIdle;
+   std::atomic<int> nOpen;
+   int nBusy;
+   bool exhausted;
+};
+
+inline CubeQueue::CubeQueue()
+      : open(1),
+        nIdle(0),
+        nOpen(1),
+        nBusy(0),
+        exhausted(false)
+{
+}
+
+template <typename Stop>
+inline bool CubeQueue::take(vec<Lit> & cube, Stop const & isStopped)
+{
+   std::unique_lock<std::mutex> lock(mtx);
+   ++nIdle;
+   while (open.empty() && !exhausted && !isStopped())
+      cv.wait_for(lock, std::chrono::milliseconds(1));
+   --nIdle;
+   if (open.empty())
+      return false;
+   cube.clear();
+   for (size_t i = 0; i < open.front().size(); ++i)
+      cube.push(open.front()[i]);
+   open.pop_front();
+   --nOpen;
+   ++nBusy;
+   return true;
+}
+
+inline void CubeQueue::add(vec<Lit> const & cube)
+{
+   std::lock_guard<std::mutex> lock(mtx);
+   open.emplace_back(&cube[0], &cube[0] + cube.size());
+   ++nOpen;
+   cv.notify_one();
+}
+
+inline void CubeQueue::done()
+{
+   std::lock_guard<std::mutex> lock(mtx);
+   assert(nBusy > 0);
+   if (--nBusy == 0 && open.empty())
+   {
+      exhausted = true;
+      cv.notify_all();
+   }
+}
+
+inline bool CubeQueue::needsCubes() const
+{
+   return nIdle > nOpen;
+}
+
+inline bool CubeQueue::isExhausted() const
+{
+   std::lock_guard<std::mutex> lock(mtx);
+   return exhausted;
+}
+
+}
+
+#endif /* SOURCES_PARALLEL_CUBEQUEUE_H_ */
@@ -37,7 +37,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <zlib.h>
 
-#include "parallel/AtomicConnector.h"
+#include "parallel/RingConnector.h"
 #include "parallel/ParallelSolveRunner.h"
 #include "utils/System.h"
 #include "utils/ParseUtils.h"
@@ -81,7 +81,7 @@ int main(int argc, char** argv)
       }
       else
       {
-         ret = ParallelSolverRunner<AtomicConnector>::run();
+         ret = ParallelSolverRunner<RingConnector>::run();
       }
 
 
@@ -40,9 +40,12 @@
 #include "parallel/ParallelStatistic.h"
 #include "core/Statistic.h"
 #include "parallel/AtomicConnector.h"
+#include "parallel/CubeQueue.h"
 #include "utils/Timer.h"
 #include "utils/Logger.h"
+#include "utils/ProofMerger.h"
 
+#include <cstdio>
 #include <pthread.h>
 #include <vector>
 #include <memory>
@@ -68,10 +71,19 @@ class ParallelSolverRunner : public SolverRunner
       Timer initTime;
       printSolverAnnouncement();
       std::shared_ptr<SolverMemory> mem = getSolveMemory();
-      startThreads(Inputs::nThreads, mem->tdata, mem->conn, mem->inst);
-      runLoop(mem->conn, mem->tdata, mem->inst);
-      lbool res = finalizeResult(mem->conn, mem->inst);
-      joinThreads(mem->conn, mem->tdata);
+      lbool res = lbool::False();
+      if (!mem->inst.isOk())
+      {
+         LOG("Solved through preprocessor")
+         printf("s UNSATISFIABLE\n");
+      } else
+      {
+         startThreads(Inputs::nThreads, mem->tdata, mem->conn, mem->inst, 0, mem->cubes.get());
+         runLoop(mem->conn, mem->tdata, mem->inst);
+         res = finalizeResult(mem->conn, mem->inst);
+         joinThreads(mem->conn, mem->tdata);
+         mergeProofs(mem->tdata, mem->inst);
+      }
       LOG_DEINIT
       std::cout << "c complete time: " << initTime.getPassedTime() << std::endl;
       return res;
@@ -81,12 +93,14 @@ class ParallelSolverRunner : public SolverRunner
 
    struct SolverMemory
    {
-      AtomicConnector conn;
+      ConnType conn;
       SatInstance inst;
       std::vector<TData> tdata;
+      std::unique_ptr<CubeQueue> cubes;  // null for the portfolio
 
       SolverMemory()
-            : conn(Inputs::mbExchangeBufferPerThread * 1024ul * 1024ul, Inputs::nThreads)
+            : conn(Inputs::mbExchangeBufferPerThread * 1024ul * 1024ul, Inputs::nThreads,
+                   Inputs::mbExchangeBufferMax * 1024ul * 1024ul)
       {
       }
    };
@@ -103,7 +117,16 @@ class ParallelSolverRunner : public SolverRunner
    {
       LOG_INIT(0)
       std::shared_ptr<SolverMemory> res = std::make_shared<SolverMemory>();
-      res->inst = getInstance((*Inputs::argv)[1], SolverConfig::getInputConfig());
+      SolverConfig config = SolverConfig::getInputConfig();
+      config.preproThreads = Inputs::nThreads;
+      res->inst = getInstance((*Inputs::argv)[1], config);
+      if (Inputs::cube)
+      {
+         if (res->inst.drat.isActive())
+            printf("c The cube mode writes no proof. Running the portfolio instead.\n");
+         else
+            res->cubes.reset(new CubeQueue());
+      }
       return res;
    }
 
@@ -112,7 +135,8 @@ class ParallelSolverRunner : public SolverRunner
                             std::vector<TData> & tdata,
                             ConnType & conn,
                             SatInstance const & inst,
-                            int const rank = 0)
+                            int const rank = 0,
+                            CubeQueue * const cubes = nullptr)
    {
       LOG("Starting " + std::to_string(threadCount) + " threads")
       tdata.reserve(threadCount);
@@ -120,6 +144,10 @@ class ParallelSolverRunner : public SolverRunner
       for (size_t i = 0; i < threadCount; ++i)
       {
          tdata.emplace_back(TData(inst, conn, i, rank));
+         tdata[i].cubes = cubes;
+         if (inst.drat.isActive())
+            tdata[i].proofFile = static_cast<std::string>(Inputs::drat_file) + ".thread"
+               + std::to_string(i);
          if (!startThread(tdata[i]))
             throw InputException();  // FIXME stop started threads
       }
@@ -139,10 +167,10 @@ class ParallelSolverRunner : public SolverRunner
             model[i] = (inst.model[i].isUndef()) ? model[i] : inst.model[i];
          elimDb.extendModel(model);
          if (Inputs::model)
-            elimDb.printModel(model);
+            printModel(model, elimDb);
          if (Inputs::verifySat)
          {
-            if (ModelChecker::checkSat(model, (*Inputs::argv)[1],inst.isDecisionVar))
+            if (checkModel(model, inst, Inputs::nThreads))
                std::cout << "c SAT solution is correct\n";
             else
                std::cout << "c Solution is WRONG!!!!\n";
@@ -186,6 +214,21 @@ class ParallelSolverRunner : public SolverRunner
       }
    }
 
+   // Appends the proofs of the threads to the proof of the preprocessor and removes them.
+   static void mergeProofs(std::vector<TData> & tdata, SatInstance & inst)
+   {
+      if (!inst.drat.isActive())
+         return;
+      LOG("Merging proofs")
+      std::vector<std::string> files;
+      for (size_t i = 0; i < tdata.size(); ++i)
+         files.push_back(tdata[i].proofFile);
+      ProofMerger<decltype(SatInstance::ca)::Lit>::merge(files, inst.drat);
+      inst.drat.flush();
+      for (size_t i = 0; i < files.size(); ++i)
+         std::remove(files[i].c_str());
+   }
+
    static void * pthreadStart(void * v)
    {
       ThreadData<ConnType> & data = *reinterpret_cast<ThreadData<ConnType>*>(v);
@@ -48,14 +48,27 @@ struct PStatistic
    uint64_t decisions;
    uint64_t propagations;
    uint64_t spropagations;
+   uint64_t viviClauses;
+   uint64_t viviStrengthened;
+   uint64_t viviDecisions;
+   uint64_t viviReusedDecisions;
    uint64_t watchedLearnts;
 
    uint64_t nLostClauses;
+   uint64_t nExportBufferGrown;
+   uint64_t nExportLimitTightened;
+   uint64_t nExportLimitTightenedByUse;
+   uint64_t nFilteredExports;
+   uint64_t nFilteredImports;
 
    uint64_t nPromoted;
    uint64_t nReceivedClauses;
    uint64_t nSendClauses;
+   uint64_t nSendBytes;
    uint64_t nHoldBackImported;
+   uint64_t nCubes;
+   uint64_t nCubesRefuted;
+   uint64_t nCubeSplits;
 
    PStatistic()
          : nAdded(0),
@@ -64,14 +77,27 @@ struct PStatistic
            decisions(0),
            propagations(0),
            spropagations(0),
+           viviClauses(0),
+           viviStrengthened(0),
+           viviDecisions(0),
+           viviReusedDecisions(0),
            watchedLearnts(0),
 
            nLostClauses(0),
+           nExportBufferGrown(0),
+           nExportLimitTightened(0),
+           nExportLimitTightenedByUse(0),
+           nFilteredExports(0),
+           nFilteredImports(0),
 
            nPromoted(0),
            nReceivedClauses(0),
            nSendClauses(0),
-           nHoldBackImported(0)
+           nSendBytes(0),
+           nHoldBackImported(0),
+           nCubes(0),
+           nCubesRefuted(0),
+           nCubeSplits(0)
    {
    }
    void reset()
@@ -87,14 +113,27 @@ struct PStatistic
       decisions += stat.decisions;
       propagations += stat.propagations;
       spropagations += stat.spropagations;
+      viviClauses += stat.viviClauses;
+      viviStrengthened += stat.viviStrengthened;
+      viviDecisions += stat.viviDecisions;
+      viviReusedDecisions += stat.viviReusedDecisions;
       watchedLearnts += stat.watchedLearnts;
 
       nLostClauses += stat.nLostClauses;
+      nExportBufferGrown += stat.nExportBufferGrown;
+      nExportLimitTightened += stat.nExportLimitTightened;
+      nExportLimitTightenedByUse += stat.nExportLimitTightenedByUse;
+      nFilteredExports += stat.nFilteredExports;
+      nFilteredImports += stat.nFilteredImports;
 
       nPromoted += stat.nPromoted;
       nReceivedClauses += stat.nReceivedClauses;
       nSendClauses += stat.nSendClauses;
+      nSendBytes += stat.nSendBytes;
       nHoldBackImported += stat.nHoldBackImported;
+      nCubes += stat.nCubes;
+      nCubesRefuted += stat.nCubesRefuted;
+      nCubeSplits += stat.nCubeSplits;
    }
 
    void add(Statistic const & stat)
@@ -105,14 +144,27 @@ struct PStatistic
       decisions += stat.decisions;
       propagations += stat.propagations;
       spropagations += stat.s_propagations;
+      viviClauses += stat.nViviClauses;
+      viviStrengthened += stat.nViviStrengthened;
+      viviDecisions += stat.nViviDecisions;
+      viviReusedDecisions += stat.nViviReusedDecisions;
       watchedLearnts += stat.nWatchedLearnts;
 
       nLostClauses += stat.nLostClauses;
+      nExportBufferGrown += stat.nExportBufferGrown;
+      nExportLimitTightened += stat.nExportLimitTightened;
+      nExportLimitTightenedByUse += stat.nExportLimitTightenedByUse;
+      nFilteredExports += stat.nFilteredExports;
+      nFilteredImports += stat.nFilteredImports;
 
       nPromoted += stat.nPromoted;
       nReceivedClauses += stat.nReceivedClauses;
       nSendClauses += stat.nSendClauses;
+      nSendBytes += stat.nSendBytes;
       nHoldBackImported += stat.nHoldBackImported;
+      nCubes += stat.nCubes;
+      nCubesRefuted += stat.nCubesRefuted;
+      nCubeSplits += stat.nCubeSplits;
    }
 
    void print()
@@ -128,10 +180,29 @@ struct PStatistic
             static_cast<double>(spropagations * 100)
                / (spropagations + std::max(propagations, 1ul)),
             memUsedPeak());
+      printf("c vivi:%-12" PRIu64 " strengthened:%-12" PRIu64 " reused dec:%2.2f%%\n",
+             viviClauses / added, viviStrengthened / added,
+             static_cast<double>(viviReusedDecisions * 100) / std::max(viviDecisions, 1ul));
 
       printf("c prom:%-12" PRIu64" receive:%-12" PRIu64" send:%-12" PRIu64"holdIm:%-12" PRIu64"\n",
              nPromoted / added, nReceivedClauses / added, nSendClauses / added,
              nHoldBackImported / added);
+      if (nSendClauses > 0)
+         printf("c bytes per export:%.2f\n", static_cast<double>(nSendBytes) / nSendClauses);
+      if (nFilteredExports > 0 || nFilteredImports > 0)
+         printf("c filtered exports:%-12" PRIu64" (%2.2f%%) imports:%-12" PRIu64" (%2.2f%%)\n",
+                nFilteredExports / added,
+                static_cast<double>(nFilteredExports * 100)
+                   / std::max(nFilteredExports + nSendClauses, 1ul),
+                nFilteredImports / added,
+                static_cast<double>(nFilteredImports * 100)
+                   / std::max(nFilteredImports + nReceivedClauses, 1ul));
+      if (nExportBufferGrown > 0 || nExportLimitTightened > 0 || nExportLimitTightenedByUse > 0)
+         printf("c export buffer grown:%-12" PRIu64" limits tightened:%-12" PRIu64" by use:%-12" PRIu64"\n",
+                nExportBufferGrown, nExportLimitTightened, nExportLimitTightenedByUse);
+      if (nCubes > 0)
+         printf("c cubes:%-12" PRIu64" refuted:%-12" PRIu64" splits:%-12" PRIu64"\n", nCubes,
+                nCubesRefuted, nCubeSplits);
       if (nLostClauses > 0)
          std::cout
             << "c Warning: Lost "
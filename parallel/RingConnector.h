@@ -0,0 +1,264 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef SOURCES_PARALLEL_RINGCONNECTOR_H_
+#define SOURCES_PARALLEL_RINGCONNECTOR_H_
+
+#include <cstdint>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include "parallel/ClauseFilter.h"
+#include "parallel/SpmcRing.h"
+#include "core/NoConnector.h"
+
+namespace ctsat
+{
+// Exchanges the clauses of the threads of one process. Every exporter writes to its own SpmcRing,
+// so exports neither lock nor fail. The readers visit all rings in turn and only lose clauses, when
+// they fall behind by a whole ring. An exporter can grow its ring up to maxBytesPerThread, when the
+// readers fall behind. Clauses exported by several threads are filtered by their hash.
+class RingConnector : public NoConnector
+{
+
+   RingConnector(RingConnector&&) = delete;
+   RingConnector(RingConnector const &) = delete;
+   RingConnector & operator=(RingConnector&& in) = delete;
+   RingConnector & operator=(RingConnector const &) = delete;
+
+ public:
+   // The read position only identifies the reader. The positions in the rings are kept in here.
+   struct size_type
+   {
+      unsigned reader;
+   };
+
+   RingConnector(uint64_t bytesPerThread, unsigned const nThreads, uint64_t const maxBytesPerThread);
+   ~RingConnector();
+
+   static size_type startPos()
+   {
+      return size_type { npos() };
+   }
+
+   unsigned getUniqueId()
+   {
+      unsigned const res = producerCounter.fetch_add(1);
+      assert(res < rings.size());
+      return res;
+   }
+
+   bool isValid(size_type & pos);
+   size_type next(size_type & pos);
+
+   template <typename ClauseType>
+   inline ClauseType const & get(size_type const & pos) const
+   {
+      assert(pos.reader < readers.size() && readers[pos.reader].hasRecord);
+      return *reinterpret_cast<ClauseType const *>(&readers[pos.reader].record[0]);
+   }
+
+   template <typename ClauseType, typename ... Args>
+   inline bool exchange(unsigned const producer, uint64_t const & nBytes, Args ... args)
+   {
+      assert(producer < rings.size());
+      return rings[producer]->allocConstruct<ClauseType, Args...>(nBytes, args...);
+   }
+
+   bool shouldImport(size_type const & pos) const;
+
+   bool filterExport(uint32_t const hash)
+   {
+      return filter.insert(hash);
+   }
+
+   void reportImportUse(unsigned const producer, uint64_t const nUsed, uint64_t const nUnused);
+   void takeExportUse(unsigned const producer, uint64_t & nUsed, uint64_t & nUnused);
+
+   // Only called by the producer.
+   double exportFillLevel(unsigned const producer) const;
+   bool growExportBuffer(unsigned const producer);
+
+   // Returns the number of clauses the reader skipped since the last call, because they were
+   // overwritten before it got to them.
+   uint64_t takeLostClauses(size_type const & pos);
+
+ protected:
+   static const uint64_t cacheLineSize = 64;
+
+   struct Reader
+   {
+      std::unique_ptr<SpmcRing::Cursor[]> cursors;  // per ring
+      unsigned ring;  // the ring read next
+      bool hasRecord;
+      uint64_t nLost;
+      vec<SpmcRing::value_type> record;
+      char pad[cacheLineSize];  // the readers are written by different threads
+
+      Reader()
+            : ring(0),
+              hasRecord(false),
+              nLost(0)
+      {
+      }
+   };
+
+   struct ExportUse
+   {
+      std::atomic<uint64_t> nUsed;
+      std::atomic<uint64_t> nUnused;
+      char pad[cacheLineSize - 2 * sizeof(std::atomic<uint64_t>)];
+
+      ExportUse()
+            : nUsed(0),
+              nUnused(0)
+      {
+      }
+   };
+
+   static constexpr unsigned npos()
+   {
+      return ~0u;
+   }
+
+   uint64_t const maxBytesPerThread;
+   std::vector<std::unique_ptr<SpmcRing>> rings;
+   std::vector<Reader> readers;
+   ClauseFilter filter;
+   std::unique_ptr<ExportUse[]> exportUse;  // per ring
+   std::atomic<unsigned> producerCounter;
+   std::atomic<unsigned> readerCounter;
+};
+
+inline RingConnector::RingConnector(uint64_t bytesPerThread, unsigned const nThreads,
+                                    uint64_t const maxBytesPerThread)
+      : maxBytesPerThread(maxBytesPerThread),
+        readers(nThreads),
+        exportUse(new ExportUse[nThreads]),
+        producerCounter(0),
+        readerCounter(0)
+{
+   for (unsigned i = 0; i < nThreads; ++i)
+   {
+      rings.emplace_back(new SpmcRing(bytesPerThread));
+      readers[i].cursors.reset(new SpmcRing::Cursor[nThreads]);
+   }
+}
+
+inline RingConnector::~RingConnector()
+{
+}
+
+inline bool RingConnector::isValid(size_type & pos)
+{
+   if (pos.reader == npos())
+   {
+      pos.reader = readerCounter.fetch_add(1);
+      assert(pos.reader < readers.size());
+   }
+   Reader & r = readers[pos.reader];
+   for (unsigned i = 0; i < rings.size() && !r.hasRecord; ++i)
+   {
+      r.hasRecord = rings[r.ring]->read(r.cursors[r.ring], r.record, r.nLost);
+      if (!r.hasRecord)
+         r.ring = (r.ring + 1 == rings.size()) ? 0 : r.ring + 1;
+   }
+   return r.hasRecord;
+}
+
+inline RingConnector::size_type RingConnector::next(size_type & pos)
+{
+   assert(pos.reader < readers.size() && readers[pos.reader].hasRecord);
+   readers[pos.reader].hasRecord = false;
+   return pos;
+}
+
+inline bool RingConnector::shouldImport(size_type const & pos) const
+{
+   if (pos.reader == npos())
+      return true;
+   Reader const & r = readers[pos.reader];
+   for (unsigned i = 0; i < rings.size(); ++i)
+      if (rings[i]->bytesToEnd(r.cursors[i]) > 0.2 * rings[i]->capacity())
+         return true;
+   return false;
+}
+
+inline double RingConnector::exportFillLevel(unsigned const producer) const
+{
+   assert(producer < rings.size());
+   SpmcRing const & ring = *rings[producer];
+   unsigned const n = std::min<unsigned>(readerCounter.load(), readers.size());
+   uint64_t maxBytes = 0;
+   for (unsigned i = 0; i < n; ++i)
+      maxBytes = std::max(maxBytes, ring.bytesToEnd(readers[i].cursors[producer]));
+   return static_cast<double>(maxBytes) / ring.capacity();
+}
+
+inline bool RingConnector::growExportBuffer(unsigned const producer)
+{
+   assert(producer < rings.size());
+   SpmcRing & ring = *rings[producer];
+   return 2 * ring.capacity() <= maxBytesPerThread && ring.grow();
+}
+
+inline void RingConnector::reportImportUse(unsigned const producer, uint64_t const nUsed,
+                                          uint64_t const nUnused)
+{
+   assert(producer < rings.size());
+   if (nUsed > 0)
+      exportUse[producer].nUsed.fetch_add(nUsed, std::memory_order_relaxed);
+   if (nUnused > 0)
+      exportUse[producer].nUnused.fetch_add(nUnused, std::memory_order_relaxed);
+}
+
+inline void RingConnector::takeExportUse(unsigned const producer, uint64_t & nUsed,
+                                         uint64_t & nUnused)
+{
+   assert(producer < rings.size());
+   nUsed = exportUse[producer].nUsed.exchange(0, std::memory_order_relaxed);
+   nUnused = exportUse[producer].nUnused.exchange(0, std::memory_order_relaxed);
+}
+
+inline uint64_t RingConnector::takeLostClauses(size_type const & pos)
+{
+   uint64_t res = 0;
+   if (pos.reader != npos())
+      std::swap(res, readers[pos.reader].nLost);
+   return res;
+}
+}
+
+#endif /* SOURCES_PARALLEL_RINGCONNECTOR_H_ */
@@ -0,0 +1,291 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef SOURCES_PARALLEL_SPMCRING_H_
+#define SOURCES_PARALLEL_SPMCRING_H_
+
+#include <cstdint>
+#include <cstdlib>
+#include <atomic>
+#include <algorithm>
+#include <cassert>
+
+#include "mtl/Vec.h"
+#include "mtl/XAlloc.h"
+
+namespace ctsat
+{
+
+// A ring buffer with a single writer and any number of readers. The writer never waits: it
+// overwrites the oldest records. A reader, which falls behind by more than the capacity, skips the
+// overwritten records and counts them as lost. Positions are counted in words and never wrap.
+//
+// The writer can grow the ring at any time. The records behind the current end are then written to
+// a new block of twice the size, while the old blocks stay readable until destruction.
+class SpmcRing
+{
+   SpmcRing(SpmcRing const &) = delete;
+   SpmcRing(SpmcRing &&) = delete;
+   SpmcRing & operator=(SpmcRing const &) = delete;
+   SpmcRing & operator=(SpmcRing &&) = delete;
+
+ public:
+   typedef int32_t value_type;
+
+   static_assert(ATOMIC_INT_LOCK_FREE > 0, "This implementation will be too slow");
+   static_assert(ATOMIC_LLONG_LOCK_FREE > 0, "This implementation will be too slow");
+
+   // The read state of one reader in one ring. pos is only written by the reader and is read by the
+   // writer to compute the fill level.
+   struct Cursor
+   {
+      std::atomic<uint64_t> pos;
+      uint64_t seq;  // number of records read or skipped
+      Cursor()
+            : pos(0),
+              seq(0)
+      {
+      }
+   };
+
+   explicit SpmcRing(uint64_t const nBytes);
+   ~SpmcRing();
+
+   // Only called by the writer. Fails for records larger than a quarter of the capacity.
+   template <typename T, typename ... Args>
+   bool allocConstruct(uint64_t const nBytes, Args ... args);
+
+   // Only called by the writer. Doubles the capacity. Returns false, when the ring can not grow
+   // anymore.
+   bool grow();
+
+   // Copies the next record to out and moves the cursor behind it. Returns false, when there is no
+   // record to read.
+   bool read(Cursor & c, vec<value_type> & out, uint64_t & nLost) const;
+
+   uint64_t bytesToEnd(Cursor const & c) const;
+   uint64_t capacity() const;
+
+ private:
+   static const uint64_t cacheLineSize = 64;
+   static const unsigned maxBlocks = 32;
+
+   struct Block
+   {
+      uint64_t begin;  // position of the first word
+      uint64_t cap;
+      std::atomic<value_type> * data;
+
+      std::atomic<value_type> & operator[](uint64_t const pos) const
+      {
+         return data[(pos - begin) % cap];
+      }
+      uint64_t offset(uint64_t const pos) const
+      {
+         return (pos - begin) % cap;
+      }
+   };
+
+   // head is written by the writer for each record, first only when records are overwritten. Both
+   // get their own cache line, so readers polling head do not slow down the writer.
+   std::atomic<uint64_t> head;       // end of the last published record
+   char padHead[cacheLineSize - sizeof(std::atomic<uint64_t>)];
+   std::atomic<uint64_t> first;      // begin of the oldest record, which is not overwritten
+   std::atomic<uint64_t> firstSeq;   // number of records in front of first
+   char padFirst[cacheLineSize - 2 * sizeof(std::atomic<uint64_t>)];
+   std::atomic<unsigned> nBlocks;    // blocks[nBlocks-1] is written to
+   Block blocks[maxBlocks];
+
+   // Returns the block containing pos.
+   Block const & getBlock(uint64_t const pos, unsigned const n) const;
+
+   static std::atomic<value_type> * allocBlock(uint64_t const cap);
+
+   // Moves first, until the words up to end can be written.
+   void release(uint64_t const end);
+};
+
+inline SpmcRing::SpmcRing(uint64_t const nBytes)
+      : head(0),
+        first(0),
+        firstSeq(0),
+        nBlocks(1)
+{
+   blocks[0].begin = 0;
+   blocks[0].cap = std::max<uint64_t>(nBytes / sizeof(value_type), 1024);
+   blocks[0].data = allocBlock(blocks[0].cap);
+   assert(blocks[0].data[0].is_lock_free());
+}
+
+inline SpmcRing::~SpmcRing()
+{
+   for (unsigned i = 0; i < nBlocks; ++i)
+      free(blocks[i].data);
+}
+
+inline std::atomic<SpmcRing::value_type> * SpmcRing::allocBlock(uint64_t const cap)
+{
+   return reinterpret_cast<std::atomic<value_type>*>(xaligned_alloc(cacheLineSize,
+                                                     (cap * sizeof(value_type) + cacheLineSize - 1)
+                                                           / cacheLineSize * cacheLineSize));
+}
+
+inline SpmcRing::Block const & SpmcRing::getBlock(uint64_t const pos, unsigned const n) const
+{
+   unsigned i = n - 1;
+   while (blocks[i].begin > pos)
+      --i;
+   return blocks[i];
+}
+
+inline bool SpmcRing::grow()
+{
+   unsigned const n = nBlocks.load(std::memory_order_relaxed);
+   if (n == maxBlocks)
+      return false;
+   Block & b = blocks[n];
+   b.begin = head.load(std::memory_order_relaxed);
+   b.cap = 2 * blocks[n - 1].cap;
+   b.data = allocBlock(b.cap);
+   nBlocks.store(n + 1, std::memory_order_release);
+   return true;
+}
+
+inline void SpmcRing::release(uint64_t const end)
+{
+   unsigned const n = nBlocks.load(std::memory_order_relaxed);
+   uint64_t const cap = blocks[n - 1].cap;
+   uint64_t f = first.load(std::memory_order_relaxed);
+   if (f + cap >= end)
+      return;
+   uint64_t seq = firstSeq.load(std::memory_order_relaxed);
+   while (f + cap < end)
+   {
+      // padding at the end of the ring is stored with a negative length
+      value_type const len = getBlock(f, n)[f].load(std::memory_order_relaxed);
+      f += (len < 0) ? -len : len;
+      seq += len > 0;
+   }
+   firstSeq.store(seq, std::memory_order_relaxed);
+   first.store(f, std::memory_order_release);
+   // readers, which see a word written after this fence, also see the new first
+   std::atomic_thread_fence(std::memory_order_release);
+}
+
+template <typename T, typename ... Args>
+inline bool SpmcRing::allocConstruct(uint64_t const nBytes, Args ... args)
+{
+   Block const & b = blocks[nBlocks.load(std::memory_order_relaxed) - 1];
+   uint64_t const size = (nBytes + sizeof(value_type) - 1) / sizeof(value_type) + 1;
+   if (size > b.cap / 4)
+      return false;
+   uint64_t pos = head.load(std::memory_order_relaxed);
+   uint64_t const offset = b.offset(pos);
+   uint64_t const padding = (offset + size > b.cap) ? b.cap - offset : 0;
+   release(pos + padding + size);
+   if (padding > 0)
+   {
+      b[pos].store(-static_cast<value_type>(padding), std::memory_order_relaxed);
+      pos += padding;
+   }
+   void * p = reinterpret_cast<void*>(&b[pos] + 1);
+   if (p != new (p) T(args...))
+      assert(false && "The current value_type is not the systems alignment");
+   b[pos].store(size, std::memory_order_relaxed);
+   head.store(pos + size, std::memory_order_release);
+   return true;
+}
+
+inline bool SpmcRing::read(Cursor & c, vec<value_type> & out, uint64_t & nLost) const
+{
+   uint64_t pos = c.pos.load(std::memory_order_relaxed);
+   while (true)
+   {
+      uint64_t const f = first.load(std::memory_order_acquire);
+      if (pos < f)
+      {
+         uint64_t const seq = firstSeq.load(std::memory_order_relaxed);
+         if (seq > c.seq)
+         {
+            nLost += seq - c.seq;
+            c.seq = seq;
+         }
+         pos = f;
+      }
+      if (pos >= head.load(std::memory_order_acquire))
+      {
+         c.pos.store(pos, std::memory_order_relaxed);
+         return false;
+      }
+
+      Block const & b = getBlock(pos, nBlocks.load(std::memory_order_acquire));
+      uint64_t const offset = b.offset(pos);
+      value_type const len = b.data[offset].load(std::memory_order_relaxed);
+      // a torn length is only possible, when the record was overwritten, which is checked below
+      uint64_t const size = std::min<uint64_t>((len < 0) ? -len : len, b.cap - offset);
+      bool const isRecord = len > 0;
+      if (isRecord)
+      {
+         out.clear();
+         for (uint64_t i = 1; i < size; ++i)
+            out.push(b.data[offset + i].load(std::memory_order_relaxed));
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (first.load(std::memory_order_relaxed) > pos || size == 0)
+         continue;
+      pos += size;
+      if (isRecord)
+      {
+         ++c.seq;
+         c.pos.store(pos, std::memory_order_relaxed);
+         return true;
+      }
+   }
+}
+
+inline uint64_t SpmcRing::bytesToEnd(Cursor const & c) const
+{
+   uint64_t const end = head.load(std::memory_order_relaxed);
+   uint64_t const pos = c.pos.load(std::memory_order_relaxed);
+   return (end > pos) ? (end - pos) * sizeof(value_type) : 0;
+}
+
+inline uint64_t SpmcRing::capacity() const
+{
+   return blocks[nBlocks.load(std::memory_order_acquire) - 1].cap * sizeof(value_type);
+}
+}
+
+#endif /* SOURCES_PARALLEL_SPMCRING_H_ */
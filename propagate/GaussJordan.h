@@ -0,0 +1,561 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef PROPAGATE_GAUSSJORDAN_H_
+#define PROPAGATE_GAUSSJORDAN_H_
+
+#include "core/Statistic.h"
+#include "core/ImplicationGraph.h"
+#include "mtl/Vec.h"
+
+#include <cstdint>
+
+namespace ctsat
+{
+
+/**
+ * Propagation of xor constraints by incremental Gauss-Jordan elimination. The constraints are kept
+ * as rows of a bit matrix in reduced row echelon form, so every row has a basic variable, which
+ * occurs in no other row. Each row watches its basic variable and one other unassigned variable.
+ * If the basic variable is assigned, an unassigned variable of the row becomes basic by adding
+ * the row to all other rows containing it. A row without unassigned non-basic variables
+ * propagates its basic variable. Since all row operations keep the matrix equivalent, nothing has
+ * to be undone on backtracking.
+ *
+ * Reasons and conflicts are created from the row only when it propagates or conflicts. They are
+ * not attached and are freed as soon as they do not explain an assignment anymore.
+ */
+template <typename DatabaseType>
+class GaussJordan
+{
+   typedef typename DatabaseType::Lit Lit;
+   typedef typename DatabaseType::Var Var;
+   typedef typename DatabaseType::Clause Clause;
+   typedef typename DatabaseType::CRef CRef;
+
+ public:
+   GaussJordan(Statistic & stat, DatabaseType & ca, ImplicationGraph<DatabaseType> & ig);
+
+   void newVar();
+
+   // Adds the constraint, that the xor of the literals is true.
+   void addXor(vec<Lit> const & lits);
+
+   // Builds the matrix at decision level 0. Rows of one variable are removed from the matrix
+   // and returned in units. Returns false, if the constraints are contradictory.
+   bool init(vec<Lit> & units);
+
+   bool isActive() const;
+   bool isXorVar(Var const v) const;
+   int nRows() const;
+
+   template <typename BranchType, typename Propagate>
+   CRef propagate(BranchType & branch, Propagate & propEngine);
+
+   // has to be called, when the trail was shrunk to trailSize
+   void backtrack(int const trailSize);
+
+   void relocAll(DatabaseType & to);
+
+ private:
+   // the initial elimination is skipped for larger matrices
+   static constexpr uint64_t maxInitWordOps = 1ull << 30;
+
+   Statistic & stat;
+   DatabaseType & ca;
+   ImplicationGraph<DatabaseType> & ig;
+
+   int nWords;  // per row
+   int head;  // next trail position to process
+   bool backtracked;
+
+   vec<Lit> xors;  // added constraints, each terminated by Lit::Undef()
+   vec<int> varCol;  // -1 for variables without xor
+   vec<Var> colVar;
+   vec<uint64_t> matrix;
+   vec<char> rhs;
+   vec<int> basicCol;  // per row
+   vec<int> watchCol;  // per row, -1 if the row has no other unassigned variable
+   vec<vec<int>> watches;  // rows per column, might contain outdated entries
+   vec<int> dirty;  // rows changed by pivoting
+   vec<char> isDirty;
+   vec<CRef> reasons;
+   vec<Lit> tmp;
+
+   uint64_t * row(int const r);
+   bool hasCol(int const r, int const c) const;
+   void addRow(int const to, int const from);
+
+   void pivot(int const r, int const c);
+   int findUnassigned(int const r, int const skip) const;
+   // column with the highest level except skip
+   int findHighestLevel(int const r, int const skip) const;
+   // the current watch of r instead of c, if it has the same level
+   int keepWatch(int const r, int const b, int const c) const;
+   bool rowValue(int const r, int const skip) const;
+   CRef rowClause(int const r, int const skip, Lit const first);
+   void releaseReasons();
+
+   template <typename BranchType, typename Propagate>
+   CRef updateRow(int const r, BranchType & branch, Propagate & propEngine);
+   template <typename BranchType, typename Propagate>
+   CRef updateDirty(BranchType & branch, Propagate & propEngine);
+};
+
+template <typename DatabaseType>
+inline GaussJordan<DatabaseType>::GaussJordan(
+                                              Statistic & stat,
+                                              DatabaseType & ca,
+                                              ImplicationGraph<DatabaseType> & ig)
+      : stat(stat),
+        ca(ca),
+        ig(ig),
+        nWords(0),
+        head(0),
+        backtracked(false)
+{
+}
+
+template <typename DatabaseType>
+inline void GaussJordan<DatabaseType>::newVar()
+{
+   varCol.push(-1);
+}
+
+template <typename DatabaseType>
+inline void GaussJordan<DatabaseType>::addXor(vec<Lit> const & lits)
+{
+   for (int i = 0; i < lits.size(); ++i)
+      xors.push(lits[i]);
+   xors.push(Lit::Undef());
+}
+
+template <typename DatabaseType>
+inline bool GaussJordan<DatabaseType>::isActive() const
+{
+   return basicCol.size() > 0;
+}
+
+template <typename DatabaseType>
+inline bool GaussJordan<DatabaseType>::isXorVar(Var const v) const
+{
+   return varCol[v] >= 0;
+}
+
+template <typename DatabaseType>
+inline int GaussJordan<DatabaseType>::nRows() const
+{
+   return basicCol.size();
+}
+
+template <typename DatabaseType>
+inline uint64_t * GaussJordan<DatabaseType>::row(int const r)
+{
+   return &matrix[r * nWords];
+}
+
+template <typename DatabaseType>
+inline bool GaussJordan<DatabaseType>::hasCol(int const r, int const c) const
+{
+   return (matrix[r * nWords + (c >> 6)] >> (c & 63)) & 1;
+}
+
+template <typename DatabaseType>
+inline void GaussJordan<DatabaseType>::addRow(int const to, int const from)
+{
+   uint64_t * t = row(to);
+   uint64_t const * f = row(from);
+   for (int i = 0; i < nWords; ++i)
+      t[i] ^= f[i];
+   rhs[to] ^= rhs[from];
+}
+
+template <typename DatabaseType>
+bool GaussJordan<DatabaseType>::init(vec<Lit> & units)
+{
+   assert(ig.decisionLevel() == 0);
+   int nXors = 0;
+   for (int i = 0; i < xors.size(); ++i)
+      if (xors[i] == Lit::Undef())
+         ++nXors;
+      else if (varCol[xors[i].var()] < 0)
+      {
+         varCol[xors[i].var()] = colVar.size();
+         colVar.push(xors[i].var());
+      }
+   nWords = (colVar.size() + 63) / 64;
+   if (static_cast<uint64_t>(nXors) * nXors * nWords > maxInitWordOps)
+   {
+      for (int i = 0; i < colVar.size(); ++i)
+         varCol[colVar[i]] = -1;
+      colVar.clear();
+      xors.clear(true);
+      return true;
+   }
+
+   // A negative literal adds one to the right hand side:
+   matrix.growTo(nXors * nWords, 0);
+   rhs.growTo(nXors, 1);
+   for (int i = 0, r = 0; i < xors.size(); ++i)
+      if (xors[i] == Lit::Undef())
+         ++r;
+      else
+      {
+         int const c = varCol[xors[i].var()];
+         row(r)[c >> 6] ^= uint64_t(1) << (c & 63);
+         rhs[r] ^= xors[i].sign();
+      }
+   xors.clear(true);
+
+   // Reduced row echelon form, empty rows are removed:
+   int n = 0;
+   for (int r = 0; r < nXors; ++r)
+   {
+      if (r != n)
+      {
+         for (int i = 0; i < nWords; ++i)
+            row(n)[i] = row(r)[i];
+         rhs[n] = rhs[r];
+      }
+      int c = -1;
+      for (int i = 0; i < nWords && c < 0; ++i)
+         if (row(n)[i] != 0)
+            c = i * 64 + __builtin_ctzll(row(n)[i]);
+      if (c < 0)
+      {
+         if (rhs[n])
+            return false;
+         continue;
+      }
+      for (int r2 = 0; r2 < nXors; ++r2)
+         if (r2 != n && (r2 < n || r2 > r) && hasCol(r2, c))
+            addRow(r2, n);
+      basicCol.push(c);
+      ++n;
+   }
+
+   // Single variable rows are facts:
+   int m = 0;
+   for (int r = 0; r < n; ++r)
+   {
+      if (findUnassigned(r, basicCol[r]) < 0)
+      {
+         units.push(Lit(colVar[basicCol[r]], !rhs[r]));
+         continue;
+      }
+      if (r != m)
+      {
+         for (int i = 0; i < nWords; ++i)
+            row(m)[i] = row(r)[i];
+         rhs[m] = rhs[r];
+         basicCol[m] = basicCol[r];
+      }
+      ++m;
+   }
+   basicCol.shrink(basicCol.size() - m);
+   matrix.shrink(matrix.size() - m * nWords);
+   rhs.shrink(rhs.size() - m);
+
+   watches.growTo(colVar.size());
+   watchCol.growTo(m, -1);
+   isDirty.growTo(m, 1);
+   for (int r = 0; r < m; ++r)
+   {
+      watches[basicCol[r]].push(r);
+      dirty.push(r);
+   }
+   return true;
+}
+
+// Makes c the basic column of r.
+template <typename DatabaseType>
+void GaussJordan<DatabaseType>::pivot(int const r, int const c)
+{
+   assert(hasCol(r, c));
+   for (int r2 = 0; r2 < basicCol.size(); ++r2)
+      if (r2 != r && hasCol(r2, c))
+      {
+         addRow(r2, r);
+         if (!isDirty[r2])
+         {
+            isDirty[r2] = 1;
+            dirty.push(r2);
+         }
+      }
+   basicCol[r] = c;
+   watches[c].push(r);
+   if (watchCol[r] == c)
+      watchCol[r] = -1;
+}
+
+template <typename DatabaseType>
+int GaussJordan<DatabaseType>::findUnassigned(int const r, int const skip) const
+{
+   uint64_t const * const w = &matrix[r * nWords];
+   for (int i = 0; i < nWords; ++i)
+      for (uint64_t bits = w[i]; bits != 0; bits &= bits - 1)
+      {
+         int const c = i * 64 + __builtin_ctzll(bits);
+         if (c != skip && ig.value(colVar[c]).isUndef())
+            return c;
+      }
+   return -1;
+}
+
+template <typename DatabaseType>
+int GaussJordan<DatabaseType>::findHighestLevel(int const r, int const skip) const
+{
+   uint64_t const * const w = &matrix[r * nWords];
+   int res = -1, level = -1;
+   for (int i = 0; i < nWords; ++i)
+      for (uint64_t bits = w[i]; bits != 0; bits &= bits - 1)
+      {
+         int const c = i * 64 + __builtin_ctzll(bits);
+         if (c != skip && ig.level(colVar[c]) > level)
+         {
+            res = c;
+            level = ig.level(colVar[c]);
+         }
+      }
+   return res;
+}
+
+template <typename DatabaseType>
+inline int GaussJordan<DatabaseType>::keepWatch(int const r, int const b, int const c) const
+{
+   int const w = watchCol[r];
+   return (w >= 0 && w != b && hasCol(r, w) && ig.level(colVar[w]) == ig.level(colVar[c])) ? w : c;
+}
+
+// xor of the right hand side and the assigned variables of the row except skip
+template <typename DatabaseType>
+bool GaussJordan<DatabaseType>::rowValue(int const r, int const skip) const
+{
+   uint64_t const * const w = &matrix[r * nWords];
+   bool res = rhs[r];
+   for (int i = 0; i < nWords; ++i)
+      for (uint64_t bits = w[i]; bits != 0; bits &= bits - 1)
+      {
+         int const c = i * 64 + __builtin_ctzll(bits);
+         if (c != skip)
+            res ^= ig.value(colVar[c]).isTrue();
+      }
+   return res;
+}
+
+// Creates the clause of first and the false literals of the row except skip.
+template <typename DatabaseType>
+typename GaussJordan<DatabaseType>::CRef GaussJordan<DatabaseType>::rowClause(
+                                                                             int const r,
+                                                                             int const skip,
+                                                                             Lit const first)
+{
+   uint64_t const * const w = &matrix[r * nWords];
+   tmp.clear();
+   if (first != Lit::Undef())
+      tmp.push(first);
+   for (int i = 0; i < nWords; ++i)
+      for (uint64_t bits = w[i]; bits != 0; bits &= bits - 1)
+      {
+         int const c = i * 64 + __builtin_ctzll(bits);
+         if (c != skip)
+            tmp.push(Lit(colVar[c], ig.value(colVar[c]).isTrue()));
+      }
+   CRef const cr = ca.alloc(tmp, false);
+   reasons.push(cr);
+   return cr;
+}
+
+template <typename DatabaseType>
+template <typename BranchType, typename Propagate>
+typename GaussJordan<DatabaseType>::CRef GaussJordan<DatabaseType>::updateRow(
+                                                                             int const r,
+                                                                             BranchType & branch,
+                                                                             Propagate & propEngine)
+{
+   int b = basicCol[r];
+   if (!ig.value(colVar[b]).isUndef())
+   {
+      int const c = findUnassigned(r, b);
+      if (c >= 0)
+      {
+         pivot(r, c);
+         b = c;
+      }
+   }
+
+   if (ig.value(colVar[b]).isUndef())
+   {
+      int w = watchCol[r];
+      if (w < 0 || !hasCol(r, w) || !ig.value(colVar[w]).isUndef())
+      {
+         w = findUnassigned(r, b);
+         if (w < 0)
+         {
+            // Unit: the watch is kept on the highest level, so it is unassigned first.
+            w = keepWatch(r, b, findHighestLevel(r, b));
+            int const level = ig.level(colVar[w]);
+            CRef const cr = rowClause(r, b, Lit(colVar[b], !rowValue(r, b)));
+            propEngine.uncheckedEnqueue(branch, ca[cr][0], level, cr);
+            ++stat.nGaussProps;
+         }
+         if (w != watchCol[r])
+            watches[w].push(r);
+         watchCol[r] = w;
+      }
+      return DatabaseType::npos();
+   }
+
+   // Fully assigned: the highest levels are watched, so they are unassigned first.
+   int const highest = findHighestLevel(r, -1);
+   if (ig.level(colVar[highest]) > ig.level(colVar[b]))
+   {
+      pivot(r, highest);
+      b = highest;
+   }
+   int const second = keepWatch(r, b, findHighestLevel(r, b));
+   if (second != watchCol[r])
+      watches[second].push(r);
+   watchCol[r] = second;
+   if (!rowValue(r, -1))
+      return DatabaseType::npos();
+
+   ++stat.nGaussConflicts;
+   CRef const cr = rowClause(r, -1, Lit::Undef());
+   Clause & c = ca[cr];
+   for (int i = 1; i < c.size(); ++i)
+      if (c[i].var() == colVar[b])
+         std::swap(c[0], c[i]);
+   for (int i = 2; i < c.size(); ++i)
+      if (c[i].var() == colVar[second])
+         std::swap(c[1], c[i]);
+   return cr;
+}
+
+template <typename DatabaseType>
+template <typename BranchType, typename Propagate>
+typename GaussJordan<DatabaseType>::CRef GaussJordan<DatabaseType>::updateDirty(
+                                                                               BranchType & branch,
+                                                                               Propagate & propEngine)
+{
+   CRef confl = DatabaseType::npos();
+   while (dirty.size() > 0 && confl == DatabaseType::npos())
+   {
+      int const r = dirty.last();
+      dirty.pop();
+      isDirty[r] = 0;
+      confl = updateRow(r, branch, propEngine);
+   }
+   return confl;
+}
+
+template <typename DatabaseType>
+template <typename BranchType, typename Propagate>
+typename GaussJordan<DatabaseType>::CRef GaussJordan<DatabaseType>::propagate(
+                                                                             BranchType & branch,
+                                                                             Propagate & propEngine)
+{
+   if (backtracked)
+      releaseReasons();
+   CRef confl = updateDirty(branch, propEngine);
+   int const nAssigns = ig.nAssigns();
+   while (confl == DatabaseType::npos() && head < ig.nAssigns())
+   {
+      int const c = varCol[ig.getTrailLit(head).var()];
+      if (c >= 0)
+      {
+         vec<int> & ws = watches[c];
+         int i, j;
+         for (i = j = 0; i < ws.size() && confl == DatabaseType::npos(); ++i)
+         {
+            int const r = ws[i];
+            if (basicCol[r] != c && watchCol[r] != c)
+               continue;
+            confl = updateRow(r, branch, propEngine);
+            if (confl == DatabaseType::npos())
+               confl = updateDirty(branch, propEngine);
+            if (basicCol[r] == c || watchCol[r] == c)
+               ws[j++] = r;
+         }
+         while (i < ws.size())
+            ws[j++] = ws[i++];
+         ws.shrink(i - j);
+         if (confl != DatabaseType::npos())
+            break;
+      }
+      ++head;
+      // let the clauses propagate the new assignments first
+      if (ig.nAssigns() > nAssigns)
+         break;
+   }
+   return confl;
+}
+
+template <typename DatabaseType>
+inline void GaussJordan<DatabaseType>::backtrack(int const trailSize)
+{
+   if (head > trailSize)
+      head = trailSize;
+   backtracked = true;
+}
+
+template <typename DatabaseType>
+void GaussJordan<DatabaseType>::releaseReasons()
+{
+   int i, j;
+   for (i = j = 0; i < reasons.size(); ++i)
+   {
+      CRef const cr = reasons[i];
+      Var const v = ca[cr][0].var();
+      if (!ig.value(v).isUndef() && ig.reason(v) == cr)
+         reasons[j++] = cr;
+      else
+         ca.remove(cr);
+   }
+   reasons.shrink(i - j);
+   backtracked = false;
+}
+
+template <typename DatabaseType>
+void GaussJordan<DatabaseType>::relocAll(DatabaseType & to)
+{
+   releaseReasons();
+   for (int i = 0; i < reasons.size(); ++i)
+      ca.reloc(reasons[i], to);
+}
+
+}
+
+#endif /* PROPAGATE_GAUSSJORDAN_H_ */
@@ -37,6 +37,7 @@
 
 #include "core/Statistic.h"
 #include "core/ImplicationGraph.h"
+#include "propagate/GaussJordan.h"
 #include "mtl/Vec.h"
 #include "mtl/OccLists.h"
 
@@ -81,10 +82,14 @@ class MinisatPropagate
    CRef simplePropagate();
 
    void cancelUntilTrailRecord();
+   void simpleCancelUntil(int const level);  // backtracks decisions made with simpleUncheckEnqueue
 
    template <typename BranchType>
    void cancelUntil(BranchType & branch, int const bLevel);
 
+   int nBinaryImplications(Lit const p) const;  // binary clauses propagated by p, including removed ones
+   Lit binaryImplication(Lit const p, int const idx) const;  // Lit::Undef() for a removed clause
+
    bool isAttached(CRef const & ref) const;
    bool isBadAttached(CRef const & ref) const;
 
@@ -93,6 +98,7 @@ class MinisatPropagate
 
    int qhead;  // Head of queue (as index into the trail -- no more explicit propagation queue in MiniSat).
    int trailRecord;
+   GaussJordan<DatabaseType> gauss;  // propagates the xor constraints after the clauses
  private:
    Statistic & stat;
    DatabaseType & ca;
@@ -145,6 +151,7 @@ inline typename MinisatPropagate<DatabaseType>::CRef MinisatPropagate<DatabaseTy
    watches.cleanAll();
    watches_bin.cleanAll();
 
+   PropagateClauses:
    while (qhead < ig.nAssigns())
    {
       Lit p = ig.getTrailLit(qhead++);   // 'p' is enqueued fact to propagate.
@@ -250,6 +257,12 @@ inline typename MinisatPropagate<DatabaseType>::CRef MinisatPropagate<DatabaseTy
       }
       ws.shrink(i - j);
    }
+   if (confl == DatabaseType::npos() && gauss.isActive())
+   {
+      confl = gauss.propagate(branch, *this);
+      if (confl == DatabaseType::npos() && qhead < ig.nAssigns())
+         goto PropagateClauses;
+   }
 
    ExitProp: ;
    stat.propagations += num_props;
@@ -280,6 +293,7 @@ void MinisatPropagate<DatabaseType>::cancelUntil(BranchType & branch, int const
          }
       }
       qhead = tEnd;
+      gauss.backtrack(tEnd);
       ig.backtrack(bLevel);
       for (int nLitId = lowLevelLits.size() - 1; nLitId >= 0; --nLitId)
          ig.assign(lowLevelLits[nLitId]);
@@ -295,6 +309,7 @@ MinisatPropagate<DatabaseType>::MinisatPropagate(
                                              ImplicationGraph<DatabaseType> & ig)
       : qhead(0),
         trailRecord(0),
+        gauss(stat, db, ig),
         stat(stat),
         ca(db),
         ig(ig),
@@ -415,7 +430,7 @@ template <typename DatabaseType>
 inline void MinisatPropagate<DatabaseType>::simpleUncheckEnqueue(Lit p, CRef from)
 {
    assert(ig.value(p).isUndef());
-   ig.assign(p, from);
+   ig.assign(p, from, ig.decisionLevel());
 }
 
 
@@ -453,9 +468,36 @@ inline void MinisatPropagate<DatabaseType>::cancelUntilTrailRecord()
 
    }
    qhead = trailRecord;
+   gauss.backtrack(trailRecord);
    ig.shrink(ig.nAssigns() - trailRecord);
 }
 
+template <typename DatabaseType>
+inline int MinisatPropagate<DatabaseType>::nBinaryImplications(Lit const p) const
+{
+   return watches_bin[p].size();
+}
+
+template <typename DatabaseType>
+inline typename MinisatPropagate<DatabaseType>::Lit MinisatPropagate<DatabaseType>::binaryImplication(
+                                                                                                   Lit const p,
+                                                                                                   int const idx) const
+{
+   Watcher const & w = watches_bin[p][idx];
+   return (ca[w.cref].mark() == 1) ? Lit::Undef() : w.blocker;
+}
+
+template <typename DatabaseType>
+inline void MinisatPropagate<DatabaseType>::simpleCancelUntil(int const level)
+{
+   assert(level < ig.decisionLevel());
+   for (int c = ig.nAssigns() - 1; c >= ig.levelEnd(level); c--)
+      ig.unassign(ig.getTrailLit(c).var());
+   qhead = ig.levelEnd(level);
+   gauss.backtrack(qhead);
+   ig.backtrack(level);
+}
+
 // Creates a new SAT variable in the solver. If 'decision' is cleared, variable will not be
 // used as a decision variable (NOTE! This has effects on the meaning of a SATISFIABLE result).
 //
@@ -467,6 +509,7 @@ typename MinisatPropagate<DatabaseType>::Var MinisatPropagate<DatabaseType>::new
    watches_bin.init(Lit(v, true));
    watches.init(Lit(v, false));
    watches.init(Lit(v, true));
+   gauss.newVar();
 
    return v;
 }
@@ -753,6 +796,7 @@ void MinisatPropagate<DatabaseType>::relocAll(DatabaseType& to)
          for (int j = 0; j < ws_bin.size(); j++)
             ca.reloc(ws_bin[j].cref, to);
       }
+   gauss.relocAll(to);
 }
 
 }
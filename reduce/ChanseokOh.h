@@ -68,6 +68,14 @@ class ChanseokOhReduce
    template <typename ApplyFunctor>
    void applyRemoveGoodClauses(ApplyFunctor const & func);
 
+   // same as applyRemoveGoodClauses, but for the clauses of all tiers
+   template <typename ApplyFunctor>
+   void applyRemoveAllClauses(ApplyFunctor const & func);
+
+   // applies the given functor to each clause of a tier, where 0 is core, 1 tier2 and 2 local
+   template <typename ApplyFunctor>
+   void applyTierClauses(int const tier, ApplyFunctor const & func);
+
    void addClause(CRef const ref);
 
    void clauseImproved(CRef const ref);
@@ -82,6 +90,8 @@ class ChanseokOhReduce
 
  public:
 
+   static const int nTiers = 3;
+
    // Don't change the actual numbers.
    static const int LOCAL = 0;
    static const int TIER2 = 2;
@@ -236,6 +246,30 @@ void ChanseokOhReduce<Database>::applyRemoveGoodClauses(ApplyFunctor const & fun
    learnts_tier2.shrink(i - j);
 }
 
+template <typename Database>
+template <typename ApplyFunctor>
+void ChanseokOhReduce<Database>::applyRemoveAllClauses(ApplyFunctor const & func)
+{
+   applyRemoveGoodClauses(func);
+   int i = 0, j = 0;
+   for (; i < learnts_local.size(); ++i)
+      if (ca[learnts_local[i]].mark() == LOCAL && !func(learnts_local[i]))
+         learnts_local[j++] = learnts_local[i];
+   learnts_local.shrink(i - j);
+}
+
+template <typename Database>
+template <typename ApplyFunctor>
+void ChanseokOhReduce<Database>::applyTierClauses(int const tier, ApplyFunctor const & func)
+{
+   assert(tier >= 0 && tier < nTiers);
+   unsigned const mark = (tier == 0) ? CORE : (tier == 1) ? TIER2 : LOCAL;
+   vec<CRef> const & learnts = (tier == 0) ? learnts_core : (tier == 1) ? learnts_tier2 : learnts_local;
+   for (int i = 0; i < learnts.size(); ++i)
+      if (ca[learnts[i]].mark() == mark)
+         func(learnts[i]);
+}
+
 template <typename Database>
 ChanseokOhReduce<Database>::ChanseokOhReduce(
                                              SolverConfig const & config,
@@ -338,19 +372,16 @@ inline void ChanseokOhReduce<Database>::clauseImproved(const CRef ref)
    Clause & c = ca[ref];
    int const lbd = c.lbd();
 
-   assert((c.mark() == CORE || c.mark() == TIER2) && "uncomment the else if");
-
    if (c.mark() != CORE && lbd <= core_lbd_cut)
    {
       learnts_core.push(ref);
       c.mark(CORE);
+   } else if (c.mark() == LOCAL && lbd <= 6)
+   {
+      learnts_tier2.push(ref);
+      c.mark(TIER2);
+      c.touched() = stat.conflicts;
    }
-//   else if (c.mark() != TIER2 && lbd <= 6)
-//   {
-//      learnts_tier2.push(ref);
-//      c.mark(TIER2);
-//      c.touched() = stat.conflicts;
-//   }
 }
 
 template <typename Database>
@@ -95,6 +95,29 @@ class GlucoseReduce
       learnts.shrink(i - j);
    }
 
+   // same as applyRemoveGoodClauses, but for all clauses
+   template <typename ApplyFunctor>
+   void applyRemoveAllClauses(ApplyFunctor const & func)
+   {
+      int i = 0, j = 0;
+      for (; i < learnts.size(); ++i)
+         if (!func(learnts[i]))
+            learnts[j++] = learnts[i];
+      learnts.shrink(i - j);
+   }
+
+   // applies the given functor to each clause of a tier, where 0 is the better half of the learnts
+   template <typename ApplyFunctor>
+   void applyTierClauses(int const tier, ApplyFunctor const & func)
+   {
+      assert(tier >= 0 && tier < nTiers);
+      if (tier == 0)
+         sort(learnts, reduceDB_lt(ca));
+      int const limit = learnts.size() / 2;
+      for (int i = (tier == 0) ? limit : 0; i < ((tier == 0) ? learnts.size() : limit); ++i)
+         func(learnts[i]);
+   }
+
    void addClause(CRef const ref);
 
    void clauseImproved(CRef const ref);
@@ -109,6 +132,8 @@ class GlucoseReduce
 
  public:
 
+   static const int nTiers = 2;
+
    Statistic & stat;
    Database & ca;
    ImplicationGraph<Database> & ig;
@@ -0,0 +1,329 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#include "utils/DecompressReader.h"
+#include "utils/Exceptions.h"
+
+#include <cstdio>
+#include <cstring>
+#include <zlib.h>
+#ifdef CTSAT_LZMA
+#include <lzma.h>
+#endif
+#ifdef CTSAT_BZIP2
+#include <bzlib.h>
+#endif
+
+namespace ctsat
+{
+
+static unsigned char const xzMagic[] = { 0xFD, '7', 'z', 'X', 'Z', 0x00 };
+static unsigned char const bzip2Magic[] = { 'B', 'Z', 'h' };
+static unsigned char const gzipMagic[] = { 0x1F, 0x8B };
+
+static bool hasMagic(unsigned char const * data, size_t const size, unsigned char const * magic,
+                     size_t const n)
+{
+   return size >= n && memcmp(data, magic, n) == 0;
+}
+
+// Decompresses the file into the given buffer. Returns the number of bytes written, 0 at the end
+// of the file and -1 on errors.
+class DecompressReader::Decoder
+{
+ public:
+   virtual ~Decoder()
+   {
+   }
+   virtual long read(unsigned char * buf, size_t const size) = 0;
+};
+
+class GzipDecoder : public DecompressReader::Decoder
+{
+ public:
+   explicit GzipDecoder(std::string const & filename)
+         : in(gzopen(filename.c_str(), "rb"))
+   {
+      if (in == NULL)
+         printf("c ERROR! Could not open file: %s\n", filename.c_str()), throw InputException();
+      gzbuffer(in, 1 << 17);
+   }
+   ~GzipDecoder()
+   {
+      gzclose(in);
+   }
+   long read(unsigned char * buf, size_t const size) override
+   {
+      return gzread(in, buf, size);
+   }
+ private:
+   gzFile in;
+};
+
+// Base of the decoders, which read the compressed file through a stdio buffer.
+class FileDecoder : public DecompressReader::Decoder
+{
+ public:
+   explicit FileDecoder(FILE * f)
+         : in(f),
+           inBuf(1 << 17),
+           inSize(0)
+   {
+   }
+   ~FileDecoder()
+   {
+      fclose(in);
+   }
+ protected:
+   FILE * in;
+   std::vector<unsigned char> inBuf;
+   size_t inSize;
+
+   // Reads the next compressed input block. Returns false on errors.
+   bool fill()
+   {
+      inSize = fread(inBuf.data(), 1, inBuf.size(), in);
+      return !ferror(in);
+   }
+};
+
+#ifdef CTSAT_LZMA
+class XzDecoder : public FileDecoder
+{
+ public:
+   explicit XzDecoder(FILE * f)
+         : FileDecoder(f),
+           strm(LZMA_STREAM_INIT)
+   {
+      if (lzma_stream_decoder(&strm, UINT64_MAX, LZMA_CONCATENATED) != LZMA_OK)
+         printf("c ERROR! Could not initialize xz decoder\n"), throw InputException();
+   }
+   ~XzDecoder()
+   {
+      lzma_end(&strm);
+   }
+   long read(unsigned char * buf, size_t const size) override
+   {
+      strm.next_out = buf;
+      strm.avail_out = size;
+      while (strm.avail_out > 0)
+      {
+         lzma_action action = LZMA_RUN;
+         if (strm.avail_in == 0)
+         {
+            if (!fill())
+               return -1;
+            strm.next_in = inBuf.data();
+            strm.avail_in = inSize;
+            if (inSize == 0)
+               action = LZMA_FINISH;
+         }
+         lzma_ret const ret = lzma_code(&strm, action);
+         if (ret == LZMA_STREAM_END)
+            break;
+         if (ret != LZMA_OK)
+            return -1;
+      }
+      return size - strm.avail_out;
+   }
+ private:
+   lzma_stream strm;
+};
+#endif
+
+#ifdef CTSAT_BZIP2
+class Bzip2Decoder : public FileDecoder
+{
+ public:
+   explicit Bzip2Decoder(FILE * f)
+         : FileDecoder(f)
+   {
+      memset(&strm, 0, sizeof(strm));
+      if (BZ2_bzDecompressInit(&strm, 0, 0) != BZ_OK)
+         printf("c ERROR! Could not initialize bzip2 decoder\n"), throw InputException();
+   }
+   ~Bzip2Decoder()
+   {
+      BZ2_bzDecompressEnd(&strm);
+   }
+   long read(unsigned char * buf, size_t const size) override
+   {
+      strm.next_out = reinterpret_cast<char *>(buf);
+      strm.avail_out = size;
+      while (strm.avail_out > 0)
+      {
+         if (strm.avail_in == 0)
+         {
+            if (!fill())
+               return -1;
+            if (inSize == 0)
+               break;
+            strm.next_in = reinterpret_cast<char *>(inBuf.data());
+            strm.avail_in = inSize;
+         }
+         int const ret = BZ2_bzDecompress(&strm);
+         if (ret == BZ_STREAM_END)
+         {
+            // Concatenated streams (e.g. from pbzip2) are decoded one after another:
+            bz_stream const last = strm;
+            BZ2_bzDecompressEnd(&strm);
+            memset(&strm, 0, sizeof(strm));
+            if (BZ2_bzDecompressInit(&strm, 0, 0) != BZ_OK)
+               return -1;
+            strm.next_in = last.next_in;
+            strm.avail_in = last.avail_in;
+            strm.next_out = last.next_out;
+            strm.avail_out = last.avail_out;
+         } else if (ret != BZ_OK)
+            return -1;
+      }
+      return size - strm.avail_out;
+   }
+ private:
+   bz_stream strm;
+};
+#endif
+
+DecompressReader::DecompressReader(std::string const & filename)
+      : sizes(),
+        nFilled(0),
+        readPos(0),
+        holdsBuffer(false),
+        finished(false),
+        failed(false),
+        stop(false)
+{
+   FILE * f = fopen(filename.c_str(), "rb");
+   if (f == NULL)
+      printf("c ERROR! Could not open file: %s\n", filename.c_str()), throw InputException();
+   unsigned char magic[sizeof(xzMagic)];
+   size_t const n = fread(magic, 1, sizeof(magic), f);
+   if (hasMagic(magic, n, xzMagic, sizeof(xzMagic)) || hasMagic(magic, n, bzip2Magic, sizeof(bzip2Magic)))
+   {
+      rewind(f);
+#ifdef CTSAT_LZMA
+      if (hasMagic(magic, n, xzMagic, sizeof(xzMagic)))
+         decoder.reset(new XzDecoder(f));
+#endif
+#ifdef CTSAT_BZIP2
+      if (hasMagic(magic, n, bzip2Magic, sizeof(bzip2Magic)))
+         decoder.reset(new Bzip2Decoder(f));
+#endif
+      if (!decoder)
+      {
+         fclose(f);
+         printf("c ERROR! The compression of %s is not supported by this build\n", filename.c_str());
+         throw InputException();
+      }
+   } else
+   {
+      fclose(f);
+      decoder.reset(new GzipDecoder(filename));
+   }
+
+   for (int i = 0; i < nBuffers; ++i)
+      buffers[i].resize(bufferSize);
+   reader = std::thread(&DecompressReader::readLoop, this);
+}
+
+DecompressReader::~DecompressReader()
+{
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      stop = true;
+   }
+   freedCv.notify_one();
+   reader.join();
+}
+
+bool DecompressReader::isCompressed(char const * data, size_t const size)
+{
+   unsigned char const * const d = reinterpret_cast<unsigned char const *>(data);
+   return hasMagic(d, size, gzipMagic, sizeof(gzipMagic)) || hasMagic(d, size, xzMagic, sizeof(xzMagic))
+      || hasMagic(d, size, bzip2Magic, sizeof(bzip2Magic));
+}
+
+size_t DecompressReader::next(unsigned char const * & data)
+{
+   std::unique_lock<std::mutex> lock(mtx);
+   if (holdsBuffer)
+   {
+      holdsBuffer = false;
+      readPos = (readPos + 1) % nBuffers;
+      --nFilled;
+      freedCv.notify_one();
+   }
+   filledCv.wait(lock, [&]
+   {  return nFilled > 0 || finished;});
+   if (nFilled == 0)
+   {
+      if (failed)
+         printf("c ERROR! Could not read input\n"), throw InputException();
+      data = nullptr;
+      return 0;
+   }
+   holdsBuffer = true;
+   data = buffers[readPos].data();
+   return sizes[readPos];
+}
+
+void DecompressReader::readLoop()
+{
+   for (int writePos = 0;; writePos = (writePos + 1) % nBuffers)
+   {
+      {
+         std::unique_lock<std::mutex> lock(mtx);
+         freedCv.wait(lock, [&]
+         {  return nFilled < nBuffers || stop;});
+         if (stop)
+            return;
+      }
+      // The buffer at writePos is neither filled nor held by the consumer:
+      long const n = decoder->read(buffers[writePos].data(), bufferSize);
+      std::lock_guard<std::mutex> lock(mtx);
+      if (n <= 0)
+      {
+         failed = n < 0;
+         finished = true;
+         filledCv.notify_one();
+         return;
+      }
+      sizes[writePos] = n;
+      ++nFilled;
+      filledCv.notify_one();
+   }
+}
+
+} /* namespace ctsat */
@@ -0,0 +1,95 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef SOURCES_UTILS_DECOMPRESSREADER_H_
+#define SOURCES_UTILS_DECOMPRESSREADER_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ctsat
+{
+
+// Reads a file on a background thread into a ring of buffers, so decompression and parsing run
+// concurrently. Plain and gzip files are read by zlib, xz and bzip2 files by liblzma and libbz2
+// if they were found at build time (CTSAT_LZMA and CTSAT_BZIP2).
+class DecompressReader
+{
+   DecompressReader(DecompressReader const &) = delete;
+   DecompressReader & operator=(DecompressReader const &) = delete;
+ public:
+   // Throws an InputException, if the file can not be opened or its format is not supported.
+   explicit DecompressReader(std::string const & filename);
+   ~DecompressReader();
+
+   // Returns the next block of the decompressed file in data and its size, which is 0 at the end
+   // of the file. The previously returned block becomes invalid. Throws an InputException, if
+   // the file can not be read.
+   size_t next(unsigned char const * & data);
+
+   // True, if the data starts with the magic number of a compressed format.
+   static bool isCompressed(char const * data, size_t const size);
+
+   class Decoder;
+
+ private:
+   static int const nBuffers = 4;
+   static size_t const bufferSize = 1 << 20;
+
+   std::unique_ptr<Decoder> decoder;
+   std::vector<unsigned char> buffers[nBuffers];
+   size_t sizes[nBuffers];
+   int nFilled;  // buffers filled by the reader thread and not yet released by next()
+   int readPos;
+   bool holdsBuffer;
+   bool finished;
+   bool failed;
+   bool stop;
+   std::mutex mtx;
+   std::condition_variable filledCv;
+   std::condition_variable freedCv;
+   std::thread reader;
+
+   void readLoop();
+};
+
+} /* namespace ctsat */
+
+#endif /* SOURCES_UTILS_DECOMPRESSREADER_H_ */
@@ -36,52 +36,66 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #ifndef MTL_DRATPRINT_H_
 #define MTL_DRATPRINT_H_
 
+#include <cassert>
+#include <cstdint>
 #include <cstdio>
+#include <memory>
 #include <string>
+#include <vector>
 #include <iostream>
 #include "mtl/Vec.h"
+#include "utils/ProofWriter.h"
 
 namespace ctsat
 {
 
+// Writes a DRAT proof in the binary or the text format. The proof is collected in a large block,
+// which is written by the background thread of a ProofWriter once it is full.
 template <typename Lit>
 class DratPrint
 {
-   template<typename E>
-   DratPrint(DratPrint<E> const &) = delete;
-   template<typename E>
-   DratPrint& operator=(DratPrint<E> const &) = delete;
+   DratPrint(DratPrint const &) = delete;
+   DratPrint& operator=(DratPrint const &) = delete;
  public:
-   DratPrint(const std::string & proofFileName = "")
-         : proof((proofFileName.size() > 0) ? fopen(proofFileName.c_str(), "wb") : NULL)
+   DratPrint(const std::string & proofFileName = "", bool const binary = true)
+         : binary(binary),
+           pos(0)
    {
+      if (proofFileName.size() > 0)
+      {
+         writer = std::make_shared<ProofWriter>(proofFileName);
+         if (!writer->isOpen())
+         {
+            fprintf(stderr, "c ERROR! Could not open the proof file %s\n", proofFileName.c_str());
+            writer.reset();
+         } else
+            block.resize(ProofWriter::blockSize);
+      }
    }
 
-   template<typename E>
-   DratPrint(DratPrint<E>&& in)
+   DratPrint(DratPrint&& in)
    : DratPrint()
    {
       *this = std::move(in);
    }
-   template<typename E>
-   DratPrint& operator=(DratPrint<E>&& in)
+   DratPrint& operator=(DratPrint&& in)
    {
-      std::swap(proof,in.proof);
+      std::swap(binary, in.binary);
+      std::swap(writer, in.writer);
+      std::swap(block, in.block);
+      std::swap(pos, in.pos);
       return *this;
    }
 
    ~DratPrint()
    {
-      if (isActive())
-      {
-         fclose(proof);
-         proof = NULL;
-      }
+      if (isActive() && pos > 0)
+         writer->submit(block, pos);
    }
 
-   constexpr bool isActive() const
+   bool isActive() const
    {
-      return proof != NULL;
+      return writer != nullptr;
    }
 
    template <typename VecType>
@@ -93,64 +107,139 @@ class DratPrint
    template <typename VecType>
    void addClauseExcludeLit(const VecType & c, const Lit l)
    {
-      if (proof != NULL)
+      if (isActive())
       {
-         write('a');
+         writePrefix('a');
          for (int i = 0; i < c.size(); ++i)
             if (c[i] != l)
                writeLit(c[i]);
-         write(0);
+         writeEnd();
       }
    }
 
+   // Returns when everything added so far is written to the proof file.
    void flush()
    {
-      // FIXME maybe use a buffer
+      if (isActive())
+      {
+         writer->submit(block, pos);
+         pos = 0;
+         writer->flush();
+      }
    }
 
    void addEmptyClause()
    {
       addClause('a', vec<Lit>());
    }
-//-11479 17850
+
    template <typename VecType>
    void removeClause(const VecType & c)
    {
       addClause('d', c);
    }
+
+   // Marks the position of an exported or imported clause in a per thread proof (binary only).
+   // ProofMerger orders the threads by these points.
+   void addSyncPoint(uint64_t point)
+   {
+      if (isActive())
+      {
+         assert(binary);
+         writePrefix('s');
+         while (point > 127u)
+         {
+            block[pos++] = 128u + (point & 127u);
+            point >>= 7u;
+         }
+         block[pos++] = point;
+      }
+   }
+
    template <typename VecType>
    void addClause(const int prefix, const VecType & c)
    {
       if (isActive())
       {
-         write(prefix);
+         writePrefix(prefix);
          for (int i = 0; i < c.size(); ++i)
             writeLit(c[i]);
-         write(0);
+         writeEnd();
       }
    }
    inline void writeLit(const Lit in)
    {
-      unsigned l = in.toInt() + 2;
-      assert(l > 0u && in.toInt() + 2 > 0);
-      while (l > 127u)
+      reserve();
+      if (binary)
+      {
+         unsigned l = in.toInt() + 2;
+         assert(l > 0u && in.toInt() + 2 > 0);
+         while (l > 127u)
+         {
+            block[pos++] = 128u + (l & 127u);
+            l >>= 7u;
+         }
+         block[pos++] = l;
+      } else
       {
-         write(128u + (l & 127u));
-         l >>= 7u;
+         unsigned v = in.var() + 1;
+         if (in.sign())
+            block[pos++] = '-';
+         unsigned char digits[10];
+         int n = 0;
+         do
+         {
+            digits[n++] = '0' + v % 10;
+            v /= 10;
+         } while (v > 0);
+         while (n > 0)
+            block[pos++] = digits[--n];
+         block[pos++] = ' ';
       }
-      write(l);
    }
 
  private:
-   FILE * proof;
+   static size_t const maxLitBytes = 12;
+
+   bool binary;
+   std::shared_ptr<ProofWriter> writer;
+   std::vector<unsigned char> block;
+   size_t pos;
+
+   // Makes sure, that the block has room for one more literal or prefix:
+   inline void reserve()
+   {
+      if (pos + maxLitBytes > block.size())
+      {
+         writer->submit(block, pos);
+         pos = 0;
+      }
+   }
 
-   inline void write(const unsigned & c)
+   inline void writePrefix(const int prefix)
    {
-      assert(proof != NULL);
-      putc_unlocked((unsigned char) c, proof);
+      reserve();
+      if (binary)
+         block[pos++] = prefix;
+      else if (prefix == 'd')
+      {
+         block[pos++] = 'd';
+         block[pos++] = ' ';
+      }
+   }
+
+   inline void writeEnd()
+   {
+      reserve();
+      if (binary)
+         block[pos++] = 0;
+      else
+      {
+         block[pos++] = '0';
+         block[pos++] = '\n';
+      }
    }
 };
 }
 
 #endif /* MTL_DRATPRINT_H_ */
-
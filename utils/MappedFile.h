@@ -0,0 +1,86 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef SOURCES_UTILS_MAPPEDFILE_H_
+#define SOURCES_UTILS_MAPPEDFILE_H_
+
+#include <cstddef>
+#include <string>
+
+namespace ctsat
+{
+
+// Read only memory mapping of a whole file.
+class MappedFile
+{
+   MappedFile(MappedFile const &) = delete;
+   MappedFile & operator=(MappedFile const &) = delete;
+ public:
+   MappedFile();
+   explicit MappedFile(std::string const & filename);
+   ~MappedFile();
+
+   // Maps the file. Returns false, if it can not be mapped (e.g. it is empty or not a regular file).
+   bool open(std::string const & filename);
+   void close();
+
+   bool isOpen() const;
+
+   char const * data() const;
+   size_t size() const;
+
+ private:
+   char const * begin;
+   size_t len;
+};
+
+inline bool MappedFile::isOpen() const
+{
+   return begin != nullptr;
+}
+
+inline char const * MappedFile::data() const
+{
+   return begin;
+}
+
+inline size_t MappedFile::size() const
+{
+   return len;
+}
+
+} /* namespace ctsat */
+
+#endif /* SOURCES_UTILS_MAPPEDFILE_H_ */
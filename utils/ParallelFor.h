@@ -0,0 +1,170 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef SHARED_PARALLELFOR_H_
+#define SHARED_PARALLELFOR_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ctsat
+{
+
+// A pool of worker threads running loops in parallel. The threads are started once and wait for
+// work in between, so also small loops can be handed to the pool.
+class ParallelFor
+{
+ public:
+   explicit ParallelFor(int const nThreads);
+   ~ParallelFor();
+
+   ParallelFor(ParallelFor const &) = delete;
+   ParallelFor & operator=(ParallelFor const &) = delete;
+
+   int nThreads() const
+   {
+      return workers.size() + 1;
+   }
+
+   // Calls f(i, threadId) for all i in [0, n), the calling thread being thread 0. Indices are
+   // handed out dynamically, so results have to be stored per index to be independent of the
+   // number of threads.
+   template <typename Func>
+   void run(int const n, Func const & f);
+
+ private:
+   std::vector<std::thread> workers;
+   std::mutex mtx;
+   std::condition_variable startCv;
+   std::condition_variable doneCv;
+   std::function<void(int, int)> job;
+   std::atomic<int> next;
+   int jobSize;
+   int nBusy;
+   unsigned generation;
+   bool stop;
+
+   void work(int const threadId);
+   void workerLoop(int const threadId);
+};
+
+inline ParallelFor::ParallelFor(int const nThreads)
+      : next(0),
+        jobSize(0),
+        nBusy(0),
+        generation(0),
+        stop(false)
+{
+   for (int t = 1; t < nThreads; ++t)
+      workers.emplace_back(&ParallelFor::workerLoop, this, t);
+}
+
+inline ParallelFor::~ParallelFor()
+{
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      stop = true;
+   }
+   startCv.notify_all();
+   for (std::thread & t : workers)
+      t.join();
+}
+
+template <typename Func>
+inline void ParallelFor::run(int const n, Func const & f)
+{
+   if (workers.empty() || n <= 1)
+   {
+      for (int i = 0; i < n; ++i)
+         f(i, 0);
+      return;
+   }
+
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      job = f;
+      jobSize = n;
+      next = 0;
+      nBusy = workers.size();
+      ++generation;
+   }
+   startCv.notify_all();
+   work(0);
+
+   std::unique_lock<std::mutex> lock(mtx);
+   doneCv.wait(lock, [this]
+   {
+      return nBusy == 0;
+   });
+   job = nullptr;
+}
+
+inline void ParallelFor::work(int const threadId)
+{
+   for (int i = next++; i < jobSize; i = next++)
+      job(i, threadId);
+}
+
+inline void ParallelFor::workerLoop(int const threadId)
+{
+   unsigned seen = 0;
+   for (;;)
+   {
+      {
+         std::unique_lock<std::mutex> lock(mtx);
+         startCv.wait(lock, [&]
+         {
+            return stop || generation != seen;
+         });
+         if (stop)
+            return;
+         seen = generation;
+      }
+      work(threadId);
+      {
+         std::lock_guard<std::mutex> lock(mtx);
+         --nBusy;
+      }
+      doneCv.notify_one();
+   }
+}
+
+}
+
+#endif
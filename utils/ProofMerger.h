@@ -0,0 +1,169 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef SOURCES_UTILS_PROOFMERGER_H_
+#define SOURCES_UTILS_PROOFMERGER_H_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "mtl/Vec.h"
+#include "utils/DratPrint.h"
+#include "utils/MappedFile.h"
+
+namespace ctsat
+{
+
+// Merges the binary proofs of the threads of the parallel solver into one DRAT proof. Every
+// exported and imported clause is followed by a sync point in the proof of its thread. The sync
+// points increase over all threads and the import of a clause gets a larger one than its export.
+// So the merged proof stays valid, when the parts of the threads ending at a sync point are added
+// in the order of their sync points.
+template <typename Lit>
+class ProofMerger
+{
+ public:
+   // Appends the proofs of the files to out and stops after the first empty clause.
+   static void merge(std::vector<std::string> const & files, DratPrint<Lit> & out);
+
+ private:
+   struct Stream
+   {
+      MappedFile file;
+      unsigned char const * pos;  // begin of the records, which are not added yet
+      unsigned char const * end;
+      unsigned char const * syncEnd;  // behind the next sync point
+      uint64_t syncPoint;  // of the next sync point, 0 if there is none
+   };
+
+   static uint64_t readNumber(unsigned char const *& pos)
+   {
+      uint64_t res = 0;
+      unsigned shift = 0;
+      while (*pos > 127u)
+      {
+         res |= static_cast<uint64_t>(*pos++ & 127u) << shift;
+         shift += 7;
+      }
+      return res | (static_cast<uint64_t>(*pos++) << shift);
+   }
+
+   static void findNextSyncPoint(Stream & s);
+
+   // Returns true, if the records contained the empty clause.
+   static bool addRecords(unsigned char const * pos, unsigned char const * end, DratPrint<Lit> & out,
+                          vec<Lit> & lits);
+};
+
+template <typename Lit>
+void ProofMerger<Lit>::findNextSyncPoint(Stream & s)
+{
+   unsigned char const * pos = s.pos;
+   s.syncPoint = 0;
+   while (pos < s.end)
+   {
+      if (*pos++ == 's')
+      {
+         s.syncPoint = readNumber(pos);
+         s.syncEnd = pos;
+         return;
+      }
+      // the last byte of a non zero number is non zero, so the record ends at the next zero
+      unsigned char const * const recordEnd = static_cast<unsigned char const *>(memchr(
+            pos, 0, s.end - pos));
+      pos = (recordEnd == nullptr) ? s.end : recordEnd + 1;
+   }
+}
+
+template <typename Lit>
+bool ProofMerger<Lit>::addRecords(unsigned char const * pos, unsigned char const * end,
+                                  DratPrint<Lit> & out, vec<Lit> & lits)
+{
+   while (pos < end)
+   {
+      int const prefix = *pos++;
+      if (prefix == 's')
+      {
+         readNumber(pos);
+         continue;
+      }
+      lits.clear();
+      uint64_t l;
+      while ((l = readNumber(pos)) != 0)
+         lits.push(Lit::toLit(static_cast<int>(l) - 2));
+      out.addClause(prefix, lits);
+      if (prefix == 'a' && lits.size() == 0)
+         return true;
+   }
+   return false;
+}
+
+template <typename Lit>
+void ProofMerger<Lit>::merge(std::vector<std::string> const & files, DratPrint<Lit> & out)
+{
+   std::vector<Stream> streams(files.size());
+   for (size_t i = 0; i < files.size(); ++i)
+   {
+      Stream & s = streams[i];
+      s.file.open(files[i]);  // an empty proof can not be mapped
+      s.pos = reinterpret_cast<unsigned char const *>(s.file.data());
+      s.end = s.pos + s.file.size();
+      findNextSyncPoint(s);
+   }
+
+   vec<Lit> lits;
+   while (true)
+   {
+      Stream * next = nullptr;
+      for (size_t i = 0; i < streams.size(); ++i)
+         if (streams[i].syncPoint > 0 && (next == nullptr || streams[i].syncPoint < next->syncPoint))
+            next = &streams[i];
+      if (next == nullptr)
+         break;
+      if (addRecords(next->pos, next->syncEnd, out, lits))
+         return;
+      next->pos = next->syncEnd;
+      findNextSyncPoint(*next);
+   }
+   // the rest of the threads only depends on already added clauses:
+   for (size_t i = 0; i < streams.size(); ++i)
+      if (addRecords(streams[i].pos, streams[i].end, out, lits))
+         return;
+}
+
+} /* namespace ctsat */
+
+#endif /* SOURCES_UTILS_PROOFMERGER_H_ */
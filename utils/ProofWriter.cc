@@ -0,0 +1,117 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#include "utils/ProofWriter.h"
+
+namespace ctsat
+{
+
+ProofWriter::ProofWriter(std::string const & filename)
+      : file(fopen(filename.c_str(), "wb")),
+        writing(false),
+        stop(false)
+{
+   if (file != NULL)
+      writer = std::thread(&ProofWriter::writeLoop, this);
+}
+
+ProofWriter::~ProofWriter()
+{
+   if (file == NULL)
+      return;
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      stop = true;
+   }
+   queuedCv.notify_one();
+   writer.join();
+   fclose(file);
+}
+
+void ProofWriter::submit(std::vector<unsigned char> & block, size_t const size)
+{
+   std::vector<unsigned char> next;
+   {
+      std::unique_lock<std::mutex> lock(mtx);
+      // Limits the memory, if the solver produces the proof faster than it can be written:
+      writtenCv.wait(lock, [&]
+      {  return queue.size() < maxQueued;});
+      if (!freeBlocks.empty())
+      {
+         next.swap(freeBlocks.back());
+         freeBlocks.pop_back();
+      }
+      block.resize(size);
+      queue.emplace_back();
+      queue.back().swap(block);
+   }
+   queuedCv.notify_one();
+   next.resize(blockSize);
+   block.swap(next);
+}
+
+void ProofWriter::flush()
+{
+   std::unique_lock<std::mutex> lock(mtx);
+   writtenCv.wait(lock, [&]
+   {  return queue.empty() && !writing;});
+   fflush(file);
+}
+
+void ProofWriter::writeLoop()
+{
+   std::unique_lock<std::mutex> lock(mtx);
+   for (;;)
+   {
+      queuedCv.wait(lock, [&]
+      {  return !queue.empty() || stop;});
+      if (queue.empty())
+         return;
+      std::vector<unsigned char> block;
+      block.swap(queue.front());
+      queue.pop_front();
+      writing = true;
+      lock.unlock();
+      if (fwrite(block.data(), 1, block.size(), file) != block.size())
+         fprintf(stderr, "c ERROR! Could not write the proof\n");
+      lock.lock();
+      writing = false;
+      if (freeBlocks.size() < maxQueued)
+         freeBlocks.emplace_back(std::move(block));
+      writtenCv.notify_all();
+   }
+}
+
+} /* namespace ctsat */
@@ -0,0 +1,94 @@
+/*****************************************************************************************
+ CTSat -- Copyright (c) 2020, Marc Hartung
+ Zuse Institute Berlin, Germany
+
+ Maple_LCM_Dist_Chrono -- Copyright (c) 2018, Vadim Ryvchin, Alexander Nadel
+
+ GlucoseNbSAT -- Copyright (c) 2016,Chu Min LI,Mao Luo and Fan Xiao
+ Huazhong University of science and technology, China
+ MIS, Univ. Picardie Jules Verne, France
+
+ MapleSAT -- Copyright (c) 2016, Jia Hui Liang, Vijay Ganesh
+
+ MiniSat -- Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010  Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be included
+ in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef SOURCES_UTILS_PROOFWRITER_H_
+#define SOURCES_UTILS_PROOFWRITER_H_
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ctsat
+{
+
+// Writes blocks of proof data to a file on a background thread. Blocks are written in the order
+// they are submitted, so it may be shared by several proof streams.
+class ProofWriter
+{
+   ProofWriter(ProofWriter const &) = delete;
+   ProofWriter & operator=(ProofWriter const &) = delete;
+ public:
+   explicit ProofWriter(std::string const & filename);
+   ~ProofWriter();
+
+   bool isOpen() const;
+
+   // Hands the filled part of block over to the writer thread. block is replaced by an empty
+   // block of at least blockSize bytes.
+   void submit(std::vector<unsigned char> & block, size_t const size);
+
+   // Returns when all submitted blocks are written to the file.
+   void flush();
+
+   static size_t const blockSize = 1 << 22;
+
+ private:
+   static size_t const maxQueued = 8;
+
+   FILE * file;
+   std::deque<std::vector<unsigned char>> queue;
+   std::vector<std::vector<unsigned char>> freeBlocks;
+   bool writing;
+   bool stop;
+   std::mutex mtx;
+   std::condition_variable queuedCv;
+   std::condition_variable writtenCv;
+   std::thread writer;
+
+   void writeLoop();
+};
+
+inline bool ProofWriter::isOpen() const
+{
+   return file != NULL;
+}
+
+} /* namespace ctsat */
+
+#endif /* SOURCES_UTILS_PROOFWRITER_H_ */